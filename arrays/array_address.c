@@ -1,5 +1,10 @@
+// Build: gcc -O2 -Wall -Wextra array_address.c ../bench/bench_timing.c -o aa
+
 #include <stdio.h>
 #include <stdlib.h> // Added for malloc and free
+#include <string.h> // Added for memcpy in layout conversion
+
+#include "../bench/bench_timing.h" // Shared timing harness
 
 // h1 -- Function to calculate address for 1D array
 void *calculate_1d_address(void *base, int i, size_t element_size)
@@ -70,6 +75,231 @@ void *calculate_nd_col_major(void *base, int indices[], int dimensions[], int n,
 
     return (char *)base + offset * element_size;
 }
+// h1 -- Layout descriptor: strides precomputed once per array
+// h2 -- calculate_nd_row_major()/calculate_nd_col_major() rebuild the stride
+// h2 -- multipliers with a nested loop on EVERY call - O(n^2) in dimensions
+// h2 -- per element access. The descriptor pays that cost once at setup and
+// h2 -- every later address is n multiply-adds over stored byte strides
+#define LAYOUT_MAX_DIMS 8
+
+typedef struct
+{
+    int n;                             // Number of dimensions
+    size_t strides[LAYOUT_MAX_DIMS];   // Byte stride per dimension
+} ArrayLayout;
+
+// h1 -- Build a row-major layout descriptor (strides shrink left to right)
+ArrayLayout make_row_major_layout(const int dimensions[], int n, size_t element_size)
+{
+    ArrayLayout layout;
+    layout.n = n;
+    size_t stride = element_size;
+    for (int dim = n - 1; dim >= 0; dim--)
+    {
+        layout.strides[dim] = stride;
+        stride *= dimensions[dim];
+    }
+    return layout;
+}
+
+// h1 -- Build a column-major layout descriptor (strides grow left to right)
+ArrayLayout make_col_major_layout(const int dimensions[], int n, size_t element_size)
+{
+    ArrayLayout layout;
+    layout.n = n;
+    size_t stride = element_size;
+    for (int dim = 0; dim < n; dim++)
+    {
+        layout.strides[dim] = stride;
+        stride *= dimensions[dim];
+    }
+    return layout;
+}
+
+// h1 -- Generic address through a descriptor: one multiply-add per dimension
+void *layout_address(void *base, const ArrayLayout *layout, const int indices[])
+{
+    size_t offset = 0;
+    for (int dim = 0; dim < layout->n; dim++)
+    {
+        offset += (size_t)indices[dim] * layout->strides[dim];
+    }
+    return (char *)base + offset;
+}
+
+// h1 -- Specialized 2D/3D paths: fixed dimension count lets the compiler
+// h1 -- fold the whole offset into two or three multiply-adds, no loop
+static inline void *layout_address_2d(void *base, const ArrayLayout *layout, int i, int j)
+{
+    return (char *)base + (size_t)i * layout->strides[0] + (size_t)j * layout->strides[1];
+}
+
+static inline void *layout_address_3d(void *base, const ArrayLayout *layout, int i, int j, int k)
+{
+    return (char *)base + (size_t)i * layout->strides[0] + (size_t)j * layout->strides[1] +
+           (size_t)k * layout->strides[2];
+}
+
+// h1 -- Cursor: amortized iteration over a layout descriptor
+// h2 -- Even layout_address() redoes n multiply-adds per element; a loop that
+// h2 -- walks ADJACENT elements only ever moves by one stride at a time. The
+// h2 -- cursor keeps the current address and moves by a precomputed stride
+// h2 -- addition per step - one add instead of n multiplies - so a dense walk
+// h2 -- is bound by memory bandwidth, not address arithmetic
+typedef struct
+{
+    char *base;                    // Base address of the array
+    char *ptr;                     // Address of the element under the cursor
+    const ArrayLayout *layout;     // Strides to move by
+    int indices[LAYOUT_MAX_DIMS];  // Current position, for bounds checks
+    int dims[LAYOUT_MAX_DIMS];     // Extent of each dimension
+} ArrayCursor;
+
+// h1 -- Point a cursor at element [0, 0, ..., 0] of an array
+void cursor_init(ArrayCursor *cursor, void *base, const ArrayLayout *layout, const int dimensions[])
+{
+    cursor->base = (char *)base;
+    cursor->ptr = (char *)base;
+    cursor->layout = layout;
+    for (int dim = 0; dim < layout->n; dim++)
+    {
+        cursor->indices[dim] = 0;
+        cursor->dims[dim] = dimensions[dim];
+    }
+}
+
+// h1 -- Step the cursor one element along `dim`: a single stride addition
+// h2 -- Bounds-checked: refuses to run off the end of the dimension so a
+// h2 -- buggy loop cannot silently walk into a neighboring row (or off the
+// h2 -- allocation entirely)
+// h6 -- Returns: 1 on success, 0 if the step would leave the array (cursor unmoved)
+static inline int cursor_advance(ArrayCursor *cursor, int dim)
+{
+    if (dim < 0 || dim >= cursor->layout->n ||
+        cursor->indices[dim] + 1 >= cursor->dims[dim])
+    {
+        return 0;
+    }
+    cursor->indices[dim]++;
+    cursor->ptr += cursor->layout->strides[dim];
+    return 1;
+}
+
+// h1 -- Rewind one dimension back to index 0 (for the inner loop of a nest)
+static inline void cursor_rewind(ArrayCursor *cursor, int dim)
+{
+    cursor->ptr -= (size_t)cursor->indices[dim] * cursor->layout->strides[dim];
+    cursor->indices[dim] = 0;
+}
+
+// h1 -- Layout conversion: copy a column-major array into row-major order
+// h2 -- Accessing column-major data with row-major loops misses the cache on
+// h2 -- every element forever; converting once up front pays that cost a
+// h2 -- single time. The naive copy still strides through one of the two
+// h2 -- buffers; the tiled version works in cache-sized blocks so both the
+// h2 -- reads and the writes stay resident while a block is processed
+
+// h2 -- One element copy, with fast paths for the common element sizes so
+// h2 -- the conversion loop is not dominated by memcpy call overhead
+static inline void copy_element(void *dst, const void *src, size_t element_size)
+{
+    if (element_size == sizeof(float))
+    {
+        *(float *)dst = *(const float *)src;
+    }
+    else if (element_size == sizeof(double))
+    {
+        *(double *)dst = *(const double *)src;
+    }
+    else
+    {
+        memcpy(dst, src, element_size);
+    }
+}
+
+// h1 -- 2D conversion: dst becomes the row-major image of column-major src
+// h2 -- tile <= 1 selects the naive element-at-a-time loop; otherwise the
+// h2 -- copy is blocked into tile x tile squares
+void convert_layout_2d(void *dst, void *src, int rows, int cols, size_t element_size, int tile)
+{
+    if (tile <= 1)
+    {
+        for (int i = 0; i < rows; i++)
+        {
+            for (int j = 0; j < cols; j++)
+            {
+                copy_element(calculate_2d_row_major(dst, i, j, cols, element_size),
+                             calculate_2d_col_major(src, i, j, rows, element_size),
+                             element_size);
+            }
+        }
+        return;
+    }
+
+    for (int ii = 0; ii < rows; ii += tile)
+    {
+        int i_end = (ii + tile < rows) ? ii + tile : rows;
+        for (int jj = 0; jj < cols; jj += tile)
+        {
+            int j_end = (jj + tile < cols) ? jj + tile : cols;
+            for (int i = ii; i < i_end; i++)
+            {
+                for (int j = jj; j < j_end; j++)
+                {
+                    copy_element(calculate_2d_row_major(dst, i, j, cols, element_size),
+                                 calculate_2d_col_major(src, i, j, rows, element_size),
+                                 element_size);
+                }
+            }
+        }
+    }
+}
+
+// h1 -- 3D conversion: same idea, blocking the two fastest-varying axes
+// h2 -- (i is contiguous in the column-major source, k in the row-major
+// h2 -- destination), with the middle axis walked in full inside each block
+void convert_layout_3d(void *dst, void *src, int rows, int cols, int depth,
+                       size_t element_size, int tile)
+{
+    if (tile <= 1)
+    {
+        for (int i = 0; i < rows; i++)
+        {
+            for (int j = 0; j < cols; j++)
+            {
+                for (int k = 0; k < depth; k++)
+                {
+                    copy_element(calculate_3d_row_major(dst, i, j, k, cols, depth, element_size),
+                                 calculate_3d_col_major(src, i, j, k, rows, cols, element_size),
+                                 element_size);
+                }
+            }
+        }
+        return;
+    }
+
+    for (int ii = 0; ii < rows; ii += tile)
+    {
+        int i_end = (ii + tile < rows) ? ii + tile : rows;
+        for (int kk = 0; kk < depth; kk += tile)
+        {
+            int k_end = (kk + tile < depth) ? kk + tile : depth;
+            for (int j = 0; j < cols; j++)
+            {
+                for (int i = ii; i < i_end; i++)
+                {
+                    for (int k = kk; k < k_end; k++)
+                    {
+                        copy_element(calculate_3d_row_major(dst, i, j, k, cols, depth, element_size),
+                                     calculate_3d_col_major(src, i, j, k, rows, cols, element_size),
+                                     element_size);
+                    }
+                }
+            }
+        }
+    }
+}
+
 // h1 --
 void print_array_2d(float arr[], int rows, int cols)
 {
@@ -261,8 +491,271 @@ int main()
     printf("Column-major calc: %p\n", col_major_nd);
     printf("Column-major value: %.1f\n", *(float *)col_major_nd);
 
+    // h2 -- Layout Descriptor (precomputed strides)
+    printf("\n\n4b. LAYOUT DESCRIPTOR (PRECOMPUTED STRIDES)\n");
+    printf("===========================================\n");
+
+    ArrayLayout row_layout = make_row_major_layout(dimensions, ND, sizeof(float));
+    ArrayLayout col_layout = make_col_major_layout(dimensions, ND, sizeof(float));
+
+    // h2 -- Descriptor must agree with the per-call calculators
+    void *desc_row = layout_address(D, &row_layout, test_indices);
+    void *desc_col = layout_address(D, &col_layout, test_indices);
+    printf("Row-major descriptor:    %p (%s)\n", desc_row,
+           desc_row == row_major_nd ? "matches per-call calc" : "MISMATCH");
+    printf("Column-major descriptor: %p (%s)\n", desc_col,
+           desc_col == col_major_nd ? "matches per-call calc" : "MISMATCH");
+
+    // h2 -- Per-element loop cost: per-call stride recompute vs descriptor
+    // h2 -- Walk every element many times so the difference is measurable
+    const int address_reps = 2000;
+    int walk_indices[4];
+
+    double start = bench_now_ns();
+    size_t checksum = 0;
+    for (int rep = 0; rep < address_reps; rep++)
+    {
+        for (walk_indices[0] = 0; walk_indices[0] < dimensions[0]; walk_indices[0]++)
+            for (walk_indices[1] = 0; walk_indices[1] < dimensions[1]; walk_indices[1]++)
+                for (walk_indices[2] = 0; walk_indices[2] < dimensions[2]; walk_indices[2]++)
+                    for (walk_indices[3] = 0; walk_indices[3] < dimensions[3]; walk_indices[3]++)
+                        checksum += (size_t)calculate_nd_row_major(D, walk_indices,
+                                                                   dimensions, ND, sizeof(float));
+    }
+    BENCH_DO_NOT_OPTIMIZE(checksum);
+    double percall_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    checksum = 0;
+    for (int rep = 0; rep < address_reps; rep++)
+    {
+        for (walk_indices[0] = 0; walk_indices[0] < dimensions[0]; walk_indices[0]++)
+            for (walk_indices[1] = 0; walk_indices[1] < dimensions[1]; walk_indices[1]++)
+                for (walk_indices[2] = 0; walk_indices[2] < dimensions[2]; walk_indices[2]++)
+                    for (walk_indices[3] = 0; walk_indices[3] < dimensions[3]; walk_indices[3]++)
+                        checksum += (size_t)layout_address(D, &row_layout, walk_indices);
+    }
+    BENCH_DO_NOT_OPTIMIZE(checksum);
+    double descriptor_ns = bench_now_ns() - start;
+
+    double total_addresses = (double)address_reps * total_elements;
+    printf("\nAddress computation over %.0f element accesses:\n", total_addresses);
+    printf("Per-call stride recompute: %.2f ns/address\n", percall_ns / total_addresses);
+    printf("Layout descriptor:         %.2f ns/address\n", descriptor_ns / total_addresses);
+
+    // h2 -- Specialized 2D/3D paths collapse to a couple of multiply-adds
+    int dims2[2] = {ROWS, COLS};
+    ArrayLayout layout2d = make_row_major_layout(dims2, 2, sizeof(float));
+    void *fast2d = layout_address_2d(B, &layout2d, test_i, test_j);
+    printf("\n2D specialized path B[%d][%d]: %p (%s)\n", test_i, test_j, fast2d,
+           fast2d == (void *)&B[test_i][test_j] ? "matches &B[i][j]" : "MISMATCH");
+
+    int dims3[3] = {DIM1, DIM2, DIM3};
+    ArrayLayout layout3d = make_row_major_layout(dims3, 3, sizeof(float));
+    void *fast3d = layout_address_3d(C, &layout3d, test_i3, test_j3, test_k3);
+    printf("3D specialized path C[%d][%d][%d]: %p (%s)\n", test_i3, test_j3, test_k3, fast3d,
+           fast3d == (void *)&C[test_i3][test_j3][test_k3] ? "matches &C[i][j][k]" : "MISMATCH");
+
     free(D);
 
+    // h2 -- Cursor API (amortized strides)
+    printf("\n\n4c. CURSOR API (AMORTIZED STRIDES)\n");
+    printf("==================================\n");
+
+    // h2 -- A dense 3D volume, sized so the walk streams through memory
+    // h2 -- rather than fitting in L1 (scaled down from production volumes
+    // h2 -- so the demo stays fast)
+    const int VROWS = 256, VCOLS = 256, VDEPTH = 64;
+    int vol_dims[3] = {VROWS, VCOLS, VDEPTH};
+    size_t vol_elements = (size_t)VROWS * VCOLS * VDEPTH;
+    float *volume = (float *)malloc(vol_elements * sizeof(float));
+    if (volume == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        return 1;
+    }
+    for (size_t idx = 0; idx < vol_elements; idx++)
+    {
+        volume[idx] = (float)(idx % 1000);
+    }
+
+    ArrayLayout vol_layout = make_row_major_layout(vol_dims, 3, sizeof(float));
+
+    // h2 -- Bounds checks: advancing past the last index must refuse and
+    // h2 -- leave the cursor where it was
+    ArrayCursor probe;
+    cursor_init(&probe, volume, &vol_layout, vol_dims);
+    for (int k = 0; k < VDEPTH - 1; k++)
+    {
+        cursor_advance(&probe, 2);
+    }
+    void *before_edge = probe.ptr;
+    int edge_step = cursor_advance(&probe, 2);
+    printf("Advance past dimension edge: %s (cursor %s)\n",
+           edge_step == 0 ? "refused" : "ALLOWED - BUG",
+           probe.ptr == before_edge ? "unmoved" : "MOVED - BUG");
+    printf("Cursor address at [0][0][%d]: %s\n", VDEPTH - 1,
+           probe.ptr == (char *)calculate_3d_row_major(volume, 0, 0, VDEPTH - 1,
+                                                       VCOLS, VDEPTH, sizeof(float))
+               ? "matches per-call calc"
+               : "MISMATCH");
+
+    // h2 -- Full row-major sweep: per-call multiply chain vs cursor adds
+    const int cursor_reps = 5;
+
+    start = bench_now_ns();
+    double percall_sum = 0.0;
+    for (int rep = 0; rep < cursor_reps; rep++)
+    {
+        for (int i = 0; i < VROWS; i++)
+            for (int j = 0; j < VCOLS; j++)
+                for (int k = 0; k < VDEPTH; k++)
+                    percall_sum += *(float *)calculate_3d_row_major(volume, i, j, k,
+                                                                    VCOLS, VDEPTH, sizeof(float));
+    }
+    BENCH_DO_NOT_OPTIMIZE(percall_sum);
+    double percall_walk_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    double cursor_sum = 0.0;
+    for (int rep = 0; rep < cursor_reps; rep++)
+    {
+        ArrayCursor cur;
+        cursor_init(&cur, volume, &vol_layout, vol_dims);
+        for (int i = 0;; i++)
+        {
+            for (int j = 0;; j++)
+            {
+                for (int k = 0;; k++)
+                {
+                    cursor_sum += *(float *)cur.ptr;
+                    if (!cursor_advance(&cur, 2))
+                        break;
+                }
+                cursor_rewind(&cur, 2);
+                if (!cursor_advance(&cur, 1))
+                    break;
+            }
+            cursor_rewind(&cur, 1);
+            if (!cursor_advance(&cur, 0))
+                break;
+        }
+    }
+    BENCH_DO_NOT_OPTIMIZE(cursor_sum);
+    double cursor_walk_ns = bench_now_ns() - start;
+
+    double walk_accesses = (double)cursor_reps * (double)vol_elements;
+    printf("\nSweep of %d x %d x %d volume (%d passes):\n", VROWS, VCOLS, VDEPTH, cursor_reps);
+    printf("Per-call 3D calculator: %.2f ns/element\n", percall_walk_ns / walk_accesses);
+    printf("Cursor stride adds:     %.2f ns/element\n", cursor_walk_ns / walk_accesses);
+    printf("Sums %s (%.0f)\n", percall_sum == cursor_sum ? "agree" : "DISAGREE",
+           cursor_sum);
+
+    free(volume);
+
+    // h2 -- Layout Conversion (tiled transpose)
+    printf("\n\n4d. LAYOUT CONVERSION (TILED TRANSPOSE)\n");
+    printf("=======================================\n");
+
+    // h2 -- Correctness first, on a matrix small enough to check by eye:
+    // h2 -- naive and tiled conversion must both produce the row-major image
+    const int SROWS = 5, SCOLS = 7;
+    float cm_small[SROWS * SCOLS], rm_naive[SROWS * SCOLS], rm_tiled[SROWS * SCOLS];
+    for (int si = 0; si < SROWS; si++)
+    {
+        for (int sj = 0; sj < SCOLS; sj++)
+        {
+            cm_small[sj * SROWS + si] = si * 10.0f + sj; // Column-major fill
+        }
+    }
+    convert_layout_2d(rm_naive, cm_small, SROWS, SCOLS, sizeof(float), 0);
+    convert_layout_2d(rm_tiled, cm_small, SROWS, SCOLS, sizeof(float), 2);
+    int convert_ok = 1;
+    for (int si = 0; si < SROWS && convert_ok; si++)
+    {
+        for (int sj = 0; sj < SCOLS; sj++)
+        {
+            if (rm_naive[si * SCOLS + sj] != si * 10.0f + sj ||
+                rm_tiled[si * SCOLS + sj] != si * 10.0f + sj)
+            {
+                convert_ok = 0;
+                break;
+            }
+        }
+    }
+    printf("2D conversion %dx%d: naive and tiled both %s\n", SROWS, SCOLS,
+           convert_ok ? "correct" : "WRONG");
+
+    // h2 -- 3D correctness on an odd-sized block (exercises partial tiles)
+    const int TR = 5, TC = 3, TD = 6;
+    float cm3[TR * TC * TD], rm3[TR * TC * TD];
+    for (int si = 0; si < TR; si++)
+        for (int sj = 0; sj < TC; sj++)
+            for (int sk = 0; sk < TD; sk++)
+                cm3[sk * TR * TC + sj * TR + si] = si * 100.0f + sj * 10.0f + sk;
+    convert_layout_3d(rm3, cm3, TR, TC, TD, sizeof(float), 4);
+    int convert3_ok = 1;
+    for (int si = 0; si < TR && convert3_ok; si++)
+        for (int sj = 0; sj < TC && convert3_ok; sj++)
+            for (int sk = 0; sk < TD; sk++)
+                if (rm3[(si * TC + sj) * TD + sk] != si * 100.0f + sj * 10.0f + sk)
+                {
+                    convert3_ok = 0;
+                    break;
+                }
+    printf("3D conversion %dx%dx%d (tiled): %s\n", TR, TC, TD,
+           convert3_ok ? "correct" : "WRONG");
+
+    // h2 -- Naive vs tiled at scale: every naive iteration hits a new cache
+    // h2 -- line in one of the two buffers; 64x64 float tiles (16 KB each
+    // h2 -- way) keep both working sets in L1/L2
+    // h2 -- (4K x 4K here - scaled down from the 8K production matrices so
+    // h2 -- the demo stays fast; the miss pattern is identical)
+    const int MROWS = 4096, MCOLS = 4096;
+    size_t mat_bytes = (size_t)MROWS * MCOLS * sizeof(float);
+    float *cm_big = (float *)malloc(mat_bytes);
+    float *rm_big = (float *)malloc(mat_bytes);
+    if (cm_big == NULL || rm_big == NULL)
+    {
+        printf("Memory allocation failed!\n");
+        free(cm_big);
+        free(rm_big);
+        return 1;
+    }
+    for (size_t idx = 0; idx < (size_t)MROWS * MCOLS; idx++)
+    {
+        cm_big[idx] = (float)(idx & 0xFFFF);
+    }
+
+    const int convert_reps = 3;
+    double naive_best = 0.0, tiled_best = 0.0;
+    for (int rep = 0; rep < convert_reps; rep++)
+    {
+        start = bench_now_ns();
+        convert_layout_2d(rm_big, cm_big, MROWS, MCOLS, sizeof(float), 0);
+        double elapsed = bench_now_ns() - start;
+        BENCH_DO_NOT_OPTIMIZE(rm_big[0]);
+        if (rep == 0 || elapsed < naive_best)
+            naive_best = elapsed;
+
+        start = bench_now_ns();
+        convert_layout_2d(rm_big, cm_big, MROWS, MCOLS, sizeof(float), 64);
+        elapsed = bench_now_ns() - start;
+        BENCH_DO_NOT_OPTIMIZE(rm_big[0]);
+        if (rep == 0 || elapsed < tiled_best)
+            tiled_best = elapsed;
+    }
+
+    printf("\nConversion of %d x %d floats (%.0f MB, best of %d):\n",
+           MROWS, MCOLS, mat_bytes / 1048576.0, convert_reps);
+    printf("Naive element loop: %.1f ms (%.2f GB/s)\n",
+           naive_best / 1e6, 2.0 * mat_bytes / naive_best);
+    printf("Tiled 64x64 blocks: %.1f ms (%.2f GB/s)\n",
+           tiled_best / 1e6, 2.0 * mat_bytes / tiled_best);
+
+    free(cm_big);
+    free(rm_big);
+
     // h2 -- Additional demonstration: Access patterns
     printf("\n\n5. ACCESS PATTERN DEMONSTRATION\n");
     printf("===============================\n");
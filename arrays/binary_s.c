@@ -1,10 +1,25 @@
 // h1 -- Binary Search Algorithm Implementation in C
 // h2 -- Efficient search algorithm for sorted arrays using divide and conquer
 // h2 -- Includes performance timing and comprehensive testing
+// h2 -- Build: gcc -O2 -Wall -Wextra binary_s.c ../bench/bench_timing.c ../bench/bench_datasets.c -o bs -lpthread -lm
 
 #include <stdio.h>
-#include <time.h>   // For clock() and timing functions
-#include <stdlib.h> // For malloc() and free()
+#include <stdlib.h>   // For malloc() and free()
+#include <string.h>   // For strcmp() in the command-line mode dispatch
+#include <pthread.h>  // For the threaded benchmark mode (compile with -lpthread)
+#include <fcntl.h>    // For open() in the memory-mapped mode
+#include <unistd.h>   // For close() and write()
+#include <sys/mman.h> // For mmap()/munmap()
+#include <sys/stat.h> // For fstat()
+
+#include "../bench/bench_timing.h"   // Shared timing harness (warmup, min/median/p99)
+#include "../bench/bench_datasets.h" // Seeded dataset generators (compile with -lm)
+#include "search_generic.h"          // Type-generic specializations (i64 etc.)
+
+// h2 -- SIMD intrinsics (x86 only, guarded so other targets fall back to scalar code)
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 // h3 -- Binary Search Function
 // h4 -- Searches for target in sorted array using divide and conquer approach
@@ -36,10 +51,628 @@ int binary_search(int arr[], int size, int target)
     return -1; // Not found
 }
 
+// h3 -- Branchless Binary Search Function
+// h4 -- Same contract as binary_search() but with no data-dependent branches
+// h4 -- in the loop: the comparison feeds a conditional move instead of a
+// h4 -- taken/not-taken branch, so random probes cannot cause mispredictions
+// h4 -- Both possible next midpoints are prefetched so the cache miss for the
+// h4 -- following level starts before the current comparison resolves
+// h5 -- arr[]: Sorted integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to search for
+// h6 -- Returns: Index of target if found, -1 if not found
+// h6 -- Time Complexity: O(log n) - same as binary_search()
+// h6 -- Note: Wins on random probes where the three-way branch mispredicts
+int binary_search_branchless(int arr[], int size, int target)
+{
+    if (size <= 0)
+    {
+        return -1;
+    }
+
+    const int *base = arr;
+    int n = size;
+
+    // Shrink [base, base+n) by half each step without branching on the data
+    while (n > 1)
+    {
+        int half = n / 2;
+
+#if defined(__GNUC__) || defined(__clang__)
+        // Whichever way the comparison goes, the next midpoint is one of
+        // these two - fetch both so the next level's miss is already in flight
+        __builtin_prefetch(&base[half / 2]);
+        __builtin_prefetch(&base[half + half / 2]);
+#endif
+
+        // Compiles to a conditional move: no branch to mispredict
+        base = (base[half - 1] < target) ? base + half : base;
+        n -= half;
+    }
+
+    return (*base == target) ? (int)(base - arr) : -1;
+}
+
+// h3 -- K-Way Pipelined Binary Search Function
+// h4 -- Runs up to KWAY_MAX_LANES independent searches round-robin through
+// h4 -- one halving loop: every lane shares the same interval-size schedule,
+// h4 -- so one pass over the lanes advances each search by one level and the
+// h4 -- cache misses of all lanes are in flight at once instead of one search
+// h4 -- serializing ~log2(n) dependent misses before the next may begin
+// h4 -- Unlike binary_search_batch() this needs no sorting of the targets -
+// h4 -- memory-level parallelism, not locality, provides the win
+// h5 -- arr[]: Sorted integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- targets[]: Values to search for, any order
+// h5 -- k: Number of targets
+// h5 -- results[]: Output - index of each target if found, -1 if not
+// h6 -- Time Complexity: O(k log n) total, with up to KWAY_MAX_LANES misses
+// h6 -- overlapped per level
+#define KWAY_MAX_LANES 16
+
+void binary_search_kway(int arr[], int size, const int targets[], int k, int results[])
+{
+    if (size <= 0)
+    {
+        for (int p = 0; p < k; p++)
+        {
+            results[p] = -1;
+        }
+        return;
+    }
+
+    for (int done = 0; done < k; done += KWAY_MAX_LANES)
+    {
+        int lanes = (k - done < KWAY_MAX_LANES) ? k - done : KWAY_MAX_LANES;
+        const int *base[KWAY_MAX_LANES];
+
+        for (int lane = 0; lane < lanes; lane++)
+        {
+            base[lane] = arr;
+        }
+
+        // One level for every lane per outer iteration: the lane loop issues
+        // `lanes` independent loads before any of them must resolve
+        for (int n = size; n > 1; n -= n / 2)
+        {
+            int half = n / 2;
+            for (int lane = 0; lane < lanes; lane++)
+            {
+#if defined(__GNUC__) || defined(__clang__)
+                // Both possible midpoints of this lane's NEXT level, as in
+                // binary_search_branchless()
+                __builtin_prefetch(&base[lane][half / 2]);
+                __builtin_prefetch(&base[lane][half + half / 2]);
+#endif
+                base[lane] = (base[lane][half - 1] < targets[done + lane])
+                                 ? base[lane] + half
+                                 : base[lane];
+            }
+        }
+
+        for (int lane = 0; lane < lanes; lane++)
+        {
+            results[done + lane] = (*base[lane] == targets[done + lane])
+                                       ? (int)(base[lane] - arr)
+                                       : -1;
+        }
+    }
+}
+
+// h3 -- Full Sorted Check Function
+// h4 -- O(n) verification that no adjacent pair is out of order, for ingest
+// h4 -- time: binary search silently returns garbage on unsorted input
+// h4 -- AVX2/SSE2 paths compare 8/4 adjacent pairs per step
+// h5 -- arr[]: Integer array to verify
+// h5 -- size: Number of elements in the array
+// h6 -- Returns: 1 if ascending (non-strict), 0 if any pair is inverted
+// h6 -- Time Complexity: O(n), bandwidth-bound with the SIMD paths
+int is_sorted_full(const int arr[], int size)
+{
+    int i = 0;
+
+#if defined(__AVX2__)
+    // Compare arr[i..i+7] against arr[i+1..i+8]: any lane where the left
+    // value is greater means an inversion
+    for (; i + 9 <= size; i += 8)
+    {
+        __m256i a = _mm256_loadu_si256((const __m256i *)&arr[i]);
+        __m256i b = _mm256_loadu_si256((const __m256i *)&arr[i + 1]);
+        if (_mm256_movemask_epi8(_mm256_cmpgt_epi32(a, b)) != 0)
+        {
+            return 0;
+        }
+    }
+#elif defined(__SSE2__)
+    for (; i + 5 <= size; i += 4)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i *)&arr[i]);
+        __m128i b = _mm_loadu_si128((const __m128i *)&arr[i + 1]);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi32(a, b)) != 0)
+        {
+            return 0;
+        }
+    }
+#endif
+
+    // Scalar tail (or the whole array on non-x86 targets)
+    for (; i + 1 < size; i++)
+    {
+        if (arr[i] > arr[i + 1])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// h3 -- Sampled Sorted Check Function
+// h4 -- Cheap randomized spot-check for per-query paranoia mode: probes k
+// h4 -- random adjacent pairs instead of scanning the whole array, so safety
+// h4 -- can stay enabled on the hot path without an O(n) cost per search
+// h5 -- arr[]: Integer array to spot-check
+// h5 -- size: Number of elements in the array
+// h5 -- samples: Number of random adjacent pairs to probe
+// h5 -- seed: RNG seed (reproducible; pass e.g. a query counter)
+// h6 -- Returns: 1 if no probed pair is inverted, 0 if one is
+// h6 -- Note: Probabilistic - can miss a local inversion, never reports a
+// h6 -- false negative on a genuinely sorted array
+int is_sorted_sample(const int arr[], int size, int samples, unsigned int seed)
+{
+    if (size < 2)
+    {
+        return 1;
+    }
+
+    for (int s = 0; s < samples; s++)
+    {
+        int i = (int)(rand_r(&seed) % (unsigned int)(size - 1));
+        if (arr[i] > arr[i + 1])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// h3 -- Lower Bound Function
+// h4 -- First position where target could be inserted keeping order: the
+// h4 -- index of the first element >= target. With duplicates this is the
+// h4 -- start of the run, which binary_search()'s arbitrary hit is not
+// h5 -- arr[]: Sorted integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to locate the run start for
+// h6 -- Returns: Index in [0, size]; size means all elements are < target
+// h6 -- Time Complexity: O(log n) - same overflow-safe midpoint logic
+int lower_bound(int arr[], int size, int target)
+{
+    int low = 0;
+    int high = size; // Half-open [low, high): high is a valid answer
+
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+
+        if (arr[mid] < target)
+            low = mid + 1; // Run starts right of mid
+        else
+            high = mid; // mid could be the run start
+    }
+    return low;
+}
+
+// h3 -- Upper Bound Function
+// h4 -- Index of the first element > target: one past the end of the run
+// h5 -- arr[]: Sorted integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to locate the run end for
+// h6 -- Returns: Index in [0, size]; equals lower_bound() when target absent
+// h6 -- Time Complexity: O(log n)
+int upper_bound(int arr[], int size, int target)
+{
+    int low = 0;
+    int high = size; // Half-open [low, high)
+
+    while (low < high)
+    {
+        int mid = low + (high - low) / 2;
+
+        if (arr[mid] <= target)
+            low = mid + 1; // Run continues through mid
+        else
+            high = mid; // mid is past the run
+    }
+    return low;
+}
+
+// h3 -- Equal Range Function
+// h4 -- Both run boundaries in two O(log n) probes - a duplicate-heavy
+// h4 -- range query needs no linear crawl around a binary_search() hit
+// h5 -- arr[]: Sorted integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value whose run to delimit
+// h5 -- first: Receives lower_bound(arr, size, target)
+// h5 -- last: Receives upper_bound(arr, size, target)
+// h6 -- Note: *last - *first is the number of occurrences (0 when absent)
+void equal_range(int arr[], int size, int target, int *first, int *last)
+{
+    *first = lower_bound(arr, size, target);
+    *last = upper_bound(arr, size, target);
+}
+
+// h3 -- Interpolation Search Function
+// h4 -- Estimates the target's position from the value distribution instead
+// h4 -- of always splitting in the middle: on uniformly distributed keys
+// h4 -- (timestamps, sequential IDs, the i*2 test arrays here) this probes
+// h4 -- O(log log n) positions - ~4 memory touches at 1M elements vs ~20
+// h5 -- arr[]: Sorted integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to search for
+// h6 -- Returns: Index of target if found, -1 if not found
+// h6 -- Time Complexity: O(log log n) uniform data, O(n) worst case (skewed)
+// h6 -- Note: Position math uses 64-bit intermediates to avoid overflow
+int interpolation_search(int arr[], int size, int target)
+{
+    int low = 0;
+    int high = size - 1;
+
+    // The range check doubles as the not-found exit: once the target falls
+    // outside [arr[low], arr[high]] it cannot be present
+    while (low <= high && target >= arr[low] && target <= arr[high])
+    {
+        // A flat run would divide by zero; all remaining values are equal
+        if (arr[low] == arr[high])
+        {
+            return (arr[low] == target) ? low : -1;
+        }
+
+        // Linear estimate of where the target sits between the endpoints
+        long long span = (long long)high - low;
+        long long offset = span * ((long long)target - arr[low]) /
+                           ((long long)arr[high] - arr[low]);
+        int pos = low + (int)offset;
+
+        if (arr[pos] == target)
+            return pos; // Found at index pos
+        else if (arr[pos] < target)
+            low = pos + 1; // Search right of the estimate
+        else
+            high = pos - 1; // Search left of the estimate
+    }
+    return -1; // Not found
+}
+
+// h3 -- Eytzinger Build Helper (recursive)
+// h4 -- In-order walk of the implicit tree: node k takes the next sorted value,
+// h4 -- after its left subtree (2k+1) and before its right subtree (2k+2)
+// h5 -- Returns: Next unconsumed position in the sorted array
+static int eytzinger_build_step(const int sorted[], int eyt[], int size, int next, int k)
+{
+    if (k < size)
+    {
+        next = eytzinger_build_step(sorted, eyt, size, next, 2 * k + 1);
+        eyt[k] = sorted[next++];
+        next = eytzinger_build_step(sorted, eyt, size, next, 2 * k + 2);
+    }
+    return next;
+}
+
+// h3 -- Eytzinger Build Function
+// h4 -- Converts a sorted array into BFS (breadth-first) order: the root of
+// h4 -- the implicit search tree sits at index 0, children of node k at
+// h4 -- 2k+1 and 2k+2, so the first few levels of every search share a
+// h4 -- handful of cache lines instead of being scattered across the array
+// h5 -- sorted[]: Source array in ascending order
+// h5 -- eyt[]: Destination array (same size), receives the BFS layout
+// h5 -- size: Number of elements in both arrays
+// h6 -- Time Complexity: O(n) - each element is placed exactly once
+void eytzinger_build(const int sorted[], int eyt[], int size)
+{
+    eytzinger_build_step(sorted, eyt, size, 0, 0);
+}
+
+// h3 -- Eytzinger Search Function
+// h4 -- Walks the BFS layout from the root with unit-stride child indices
+// h5 -- eyt[]: Array in Eytzinger order (from eytzinger_build())
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to search for
+// h6 -- Returns: Index of target IN THE EYTZINGER ARRAY if found, -1 if not
+// h6 -- Time Complexity: O(log n) - one level of the implicit tree per step
+// h6 -- Note: Early levels stay cache-hot across searches; deep levels are
+// h6 -- adjacent in memory rather than a strided midpoint walk
+int eytzinger_search(int eyt[], int size, int target)
+{
+    int k = 0;
+    while (k < size)
+    {
+        if (eyt[k] == target)
+            return k; // Found at Eytzinger index k
+        else if (eyt[k] < target)
+            k = 2 * k + 2; // Descend right
+        else
+            k = 2 * k + 1; // Descend left
+    }
+    return -1; // Not found
+}
+
+// h3 -- Batch Probe Structure
+// h4 -- Pairs a target value with its position in the caller's arrays
+// h5 -- Needed so results land at the caller's original indices after sorting
+typedef struct
+{
+    int value;          // Target value to search for
+    int original_index; // Slot in targets[]/results[] this probe came from
+} BatchProbe;
+
+// h3 -- Batch Probe Comparator
+// h4 -- qsort() comparator ordering probes by ascending target value
+static int compare_batch_probes(const void *a, const void *b)
+{
+    int va = ((const BatchProbe *)a)->value;
+    int vb = ((const BatchProbe *)b)->value;
+    return (va > vb) - (va < vb); // Avoids overflow of plain subtraction
+}
+
+// h3 -- Batch Binary Search Function
+// h4 -- Answers many lookups against the same sorted array in one call
+// h4 -- Sorts the probe set first so consecutive searches touch nearby array
+// h4 -- regions: the shared upper levels of the implicit tree stay hot in L1,
+// h4 -- and each search can start from the previous probe's insertion point
+// h5 -- arr[]: Sorted integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- targets[]: Values to search for (any order, duplicates allowed)
+// h5 -- n: Number of targets
+// h5 -- results[]: Receives one index (or -1) per target, in target order
+// h6 -- Time Complexity: O(n log n) for the probe sort + O(n log size) searches
+// h6 -- Note: Falls back to nothing special for n <= 0; arr must be sorted
+void binary_search_batch(int arr[], int size, const int targets[], int n, int results[])
+{
+    if (n <= 0)
+    {
+        return;
+    }
+
+    // Sort a private copy of the probes; caller's order is restored via
+    // original_index when results are written back
+    BatchProbe *probes = (BatchProbe *)malloc(n * sizeof(BatchProbe));
+    if (probes == NULL)
+    {
+        // Degrade gracefully: answer each probe independently
+        for (int i = 0; i < n; i++)
+        {
+            results[i] = binary_search(arr, size, targets[i]);
+        }
+        return;
+    }
+
+    for (int i = 0; i < n; i++)
+    {
+        probes[i].value = targets[i];
+        probes[i].original_index = i;
+    }
+    qsort(probes, n, sizeof(BatchProbe), compare_batch_probes);
+
+    // Probes are ascending, so each answer lies at or after the previous
+    // probe's insertion point - the search window only ever shrinks
+    int window_low = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int target = probes[i].value;
+        int low = window_low;
+        int high = size - 1;
+        int found = -1;
+
+        while (low <= high)
+        {
+            int mid = low + (high - low) / 2;
+
+            if (arr[mid] == target)
+            {
+                found = mid;
+                break;
+            }
+            else if (arr[mid] < target)
+                low = mid + 1;
+            else
+                high = mid - 1;
+        }
+
+        results[probes[i].original_index] = found;
+        // Next (equal or larger) probe cannot land before this position
+        window_low = (found != -1) ? found : low;
+    }
+
+    free(probes);
+}
+
+// h3 -- Sorted Batch Insert Function
+// h4 -- Merges a sorted delta into a sorted array in one backward pass:
+// h4 -- elements are written from the high end down, so nothing is moved
+// h4 -- more than once and no scratch buffer is needed - O(n + k) instead
+// h4 -- of appending and re-sorting the whole array at O((n+k) log (n+k))
+// h5 -- arr[]: Sorted array of n elements, with capacity for at least n + k
+// h5 -- n: Current number of elements in arr
+// h5 -- delta[]: Sorted values to merge in
+// h5 -- k: Number of delta elements
+// h6 -- Returns: New element count, n + k
+// h6 -- Time Complexity: O(n + k), single pass
+int sorted_insert_batch(int arr[], int n, const int delta[], int k)
+{
+    int read = n - 1;      // Last existing element
+    int from = k - 1;      // Last delta element
+    int write = n + k - 1; // Last slot of the grown array
+
+    // Once the delta is exhausted the remaining prefix is already in place
+    while (from >= 0)
+    {
+        if (read >= 0 && arr[read] > delta[from])
+        {
+            arr[write--] = arr[read--];
+        }
+        else
+        {
+            arr[write--] = delta[from--];
+        }
+    }
+    return n + k;
+}
+
+// h3 -- Two-Level Table Structure (main + delta)
+// h4 -- The LSM-lite pattern: reads binary-search a large immutable main
+// h4 -- array plus a small sorted delta, writes go to the delta only, and
+// h4 -- the delta is folded into main with one sorted_insert_batch() pass
+// h4 -- when it reaches the threshold - so serving never stalls behind an
+// h4 -- O(n log n) re-sort during ingest
+#define TWO_LEVEL_DELTA_CAP 1024
+
+typedef struct
+{
+    int *main_arr;                 // Sorted bulk (caller-owned storage)
+    int main_count;                // Elements currently in main_arr
+    int capacity;                  // Slots in main_arr (must absorb merges)
+    int delta[TWO_LEVEL_DELTA_CAP]; // Small sorted write buffer
+    int delta_count;               // Elements currently in the delta
+    int merge_threshold;           // Delta size that triggers a merge
+} TwoLevelTable;
+
+// h3 -- Two-Level Table Setup
+// h5 -- storage: Sorted array with spare capacity; the table does not own it
+// h5 -- capacity: Total slots in storage
+// h5 -- count: Elements already present (sorted)
+// h5 -- merge_threshold: Delta fill level that triggers the lazy merge,
+// h5 --                  clamped to TWO_LEVEL_DELTA_CAP
+void table_init(TwoLevelTable *table, int *storage, int capacity, int count,
+                int merge_threshold)
+{
+    table->main_arr = storage;
+    table->main_count = count;
+    table->capacity = capacity;
+    table->delta_count = 0;
+    table->merge_threshold = (merge_threshold < TWO_LEVEL_DELTA_CAP)
+                                 ? merge_threshold
+                                 : TWO_LEVEL_DELTA_CAP;
+    if (table->merge_threshold < 1)
+    {
+        table->merge_threshold = 1;
+    }
+}
+
+// h3 -- Two-Level Table Merge
+// h4 -- Folds the delta into main immediately (also called automatically by
+// h4 -- table_insert() at the threshold)
+// h6 -- Returns: 0 on success, -1 if main lacks capacity for the merge
+int table_merge(TwoLevelTable *table)
+{
+    if (table->delta_count == 0)
+    {
+        return 0;
+    }
+    if (table->main_count + table->delta_count > table->capacity)
+    {
+        return -1;
+    }
+    table->main_count = sorted_insert_batch(table->main_arr, table->main_count,
+                                            table->delta, table->delta_count);
+    table->delta_count = 0;
+    return 0;
+}
+
+// h3 -- Two-Level Table Insert
+// h4 -- Sorted insertion into the delta - O(threshold) worst case, against a
+// h4 -- buffer small enough to live in L1 - then a lazy merge once the delta
+// h4 -- is full. Amortized cost per insert is O(threshold + n/threshold)
+// h6 -- Returns: 0 on success, -1 if a needed merge lacks capacity
+int table_insert(TwoLevelTable *table, int value)
+{
+    if (table->delta_count >= table->merge_threshold && table_merge(table) != 0)
+    {
+        return -1;
+    }
+
+    // Shift the tail up to keep the delta sorted
+    int pos = table->delta_count;
+    while (pos > 0 && table->delta[pos - 1] > value)
+    {
+        table->delta[pos] = table->delta[pos - 1];
+        pos--;
+    }
+    table->delta[pos] = value;
+    table->delta_count++;
+    return 0;
+}
+
+// h3 -- Two-Level Table Search
+// h4 -- Probes main first (almost every element lives there), then the
+// h4 -- delta - two binary searches, so reads stay O(log n) during ingest
+// h6 -- Returns: Index into main if found there; main_count + delta index
+// h6 -- for a delta hit (provisional until the next merge); -1 if absent
+int table_search(const TwoLevelTable *table, int target)
+{
+    int found = binary_search(table->main_arr, table->main_count, target);
+    if (found != -1)
+    {
+        return found;
+    }
+    found = binary_search((int *)table->delta, table->delta_count, target);
+    return (found != -1) ? table->main_count + found : -1;
+}
+
+// h3 -- Search Benchmark Context
+// h4 -- Bundles one search variant with its inputs for the timing harness
+typedef struct
+{
+    int (*fn)(int[], int, int); // Search variant under test
+    int *arr;                   // Array to probe
+    int size;                   // Number of elements
+    int target;                 // Probe value
+} SearchBenchCtx;
+
+// h3 -- Search Benchmark Callback
+// h4 -- One timed probe; returns the index so the harness can barrier it
+static int run_search_once(void *ctx)
+{
+    SearchBenchCtx *c = (SearchBenchCtx *)ctx;
+    return c->fn(c->arr, c->size, c->target);
+}
+
+// h3 -- 64-bit Benchmark Context and Callbacks
+// h4 -- The inlined i64 specialization vs libc bsearch() with a comparator
+// h4 -- function pointer - the overhead the generic header exists to remove
+typedef struct
+{
+    long long *arr;   // Sorted 64-bit key array
+    int size;         // Number of elements
+    long long target; // Probe value
+} I64BenchCtx;
+
+static int run_i64_inlined(void *ctx)
+{
+    I64BenchCtx *c = (I64BenchCtx *)ctx;
+    return binary_search_i64(c->arr, c->size, c->target);
+}
+
+// h4 -- qsort/bsearch comparator for 64-bit keys (cannot be inlined at the
+// h4 -- call site because bsearch() takes it through a function pointer)
+static int compare_i64(const void *a, const void *b)
+{
+    long long va = *(const long long *)a;
+    long long vb = *(const long long *)b;
+    return (va > vb) - (va < vb);
+}
+
+static int run_i64_bsearch(void *ctx)
+{
+    I64BenchCtx *c = (I64BenchCtx *)ctx;
+    const long long *hit = (const long long *)bsearch(
+        &c->target, c->arr, c->size, sizeof(long long), compare_i64);
+    return hit ? (int)(hit - c->arr) : -1;
+}
+
 // h3 -- Performance Test Function
-// h4 -- Tests binary search performance with large sorted arrays
+// h4 -- Tests binary search performance with large sorted arrays through
+// h4 -- the shared timing harness
 // h5 -- size: Size of test array to generate
-// h6 -- Measures execution time for multiple search operations
+// h6 -- Reports min/median/p99 per case and variant
 void performance_test(int size)
 {
     // Don't test with invalid sizes
@@ -74,40 +707,261 @@ void performance_test(int size)
 
     printf("Performance Test (Size: %d):\n", size);
 
-    // Warm up the function
-    for (int i = 0; i < 10; i++)
+    // All variants run the same cases so the numbers are comparable
+    int (*variants[])(int[], int, int) = {binary_search, binary_search_branchless,
+                                          interpolation_search};
+    const char *variant_names[] = {"branching", "branchless", "interpolation"};
+
+    // The harness handles warmup, per-sample timing, and the compiler barrier
+    const int samples = 10000;
+    char label[64];
+    for (int t = 0; t < 4; t++)
     {
-        binary_search(large_arr, size, large_arr[size / 2]);
+        for (int v = 0; v < 3; v++)
+        {
+            SearchBenchCtx ctx = {variants[v], large_arr, size, targets[t]};
+            BenchStats stats = bench_measure(run_search_once, &ctx, 10, samples);
+            snprintf(label, sizeof(label), "%s case (%s)", cases[t], variant_names[v]);
+            bench_print(label, &stats);
+        }
     }
 
-    // Test each case with multiple iterations
-    const int iterations = 10000;
-    for (int t = 0; t < 4; t++)
+    // h4 -- Eytzinger layout: same even-number data, rebuilt in BFS order so
+    // h4 -- both layouts are compared on identical values and identical cases
+    int *eyt_arr = (int *)malloc(size * sizeof(int));
+    if (eyt_arr != NULL)
     {
-        clock_t total_time = 0;
-        int found_count = 0;
+        eytzinger_build(large_arr, eyt_arr, size);
 
-        for (int iter = 0; iter < iterations; iter++)
+        for (int t = 0; t < 4; t++)
         {
-            clock_t start = clock();
-            int result = binary_search(large_arr, size, targets[t]);
-            clock_t end = clock();
-            total_time += (end - start);
+            SearchBenchCtx ctx = {eytzinger_search, eyt_arr, size, targets[t]};
+            BenchStats stats = bench_measure(run_search_once, &ctx, 10, samples);
+            snprintf(label, sizeof(label), "%s case (eytzinger)", cases[t]);
+            bench_print(label, &stats);
+        }
 
-            if (result != -1)
-            {
-                found_count++;
-            }
+        free(eyt_arr);
+    }
+
+    // h4 -- Batched case: same probe set answered one-by-one vs via the batch API
+    const int batch_n = 10000;
+    int *batch_targets = (int *)malloc(batch_n * sizeof(int));
+    int *batch_results = (int *)malloc(batch_n * sizeof(int));
+    if (batch_targets != NULL && batch_results != NULL)
+    {
+        // Random mix of hits (even values in range) and misses (odd values)
+        for (int i = 0; i < batch_n; i++)
+        {
+            batch_targets[i] = rand() % (size * 2);
+        }
+
+        double start = bench_now_ns();
+        for (int i = 0; i < batch_n; i++)
+        {
+            batch_results[i] = binary_search(large_arr, size, batch_targets[i]);
+            BENCH_DO_NOT_OPTIMIZE(batch_results[i]);
         }
+        double loop_ns = bench_now_ns() - start;
 
-        double avg_time = ((double)total_time / iterations) / CLOCKS_PER_SEC;
-        printf("  %s case: %.6f seconds (success: %d/%d)\n",
-               cases[t], avg_time, found_count, iterations);
+        start = bench_now_ns();
+        binary_search_batch(large_arr, size, batch_targets, batch_n, batch_results);
+        BENCH_DO_NOT_OPTIMIZE(batch_results[0]);
+        double batch_ns = bench_now_ns() - start;
+
+        // K-way pipelining on the same probes: no sort, the win is overlap
+        start = bench_now_ns();
+        binary_search_kway(large_arr, size, batch_targets, batch_n, batch_results);
+        BENCH_DO_NOT_OPTIMIZE(batch_results[0]);
+        double kway_ns = bench_now_ns() - start;
+
+        printf("  batched case (%d random probes):\n", batch_n);
+        printf("    one-by-one loop: %.0f ns (%.1f ns/probe)\n", loop_ns, loop_ns / batch_n);
+        printf("    batch API:       %.0f ns (%.1f ns/probe)\n", batch_ns, batch_ns / batch_n);
+        printf("    %d-way pipelined: %.0f ns (%.1f ns/probe)\n", KWAY_MAX_LANES,
+               kway_ns, kway_ns / batch_n);
+    }
+    free(batch_targets);
+    free(batch_results);
+
+    // h4 -- Hardware counters for the worst case: shows whether a variant is
+    // h4 -- latency-bound (cache misses) or mispredict-bound per lookup
+    {
+        SearchBenchCtx counter_ctx = {binary_search, large_arr, size, targets[2]};
+        BenchCounters counters = bench_count(run_search_once, &counter_ctx, 10000);
+        bench_print_counters("worst case (branching) hw", &counters);
+        counter_ctx.fn = binary_search_branchless;
+        counters = bench_count(run_search_once, &counter_ctx, 10000);
+        bench_print_counters("worst case (branchless) hw", &counters);
+    }
+
+    // h4 -- Full sorted verification cost at this size (the ingest-time check)
+    double vstart = bench_now_ns();
+    int sorted_ok = is_sorted_full(large_arr, size);
+    BENCH_DO_NOT_OPTIMIZE(sorted_ok);
+    printf("  is_sorted_full: %.0f ns (%s)\n", bench_now_ns() - vstart,
+           sorted_ok ? "sorted" : "UNSORTED");
+
+    // h4 -- 64-bit key case (what production actually runs): the inlined
+    // h4 -- specialization vs bsearch()'s uninlinable comparator pointer
+    long long *arr64 = (long long *)malloc(size * sizeof(long long));
+    if (arr64 != NULL)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            arr64[i] = (long long)i * 2; // Same even-number scheme, 64-bit
+        }
+
+        I64BenchCtx ctx64 = {arr64, size, arr64[size - 1]};
+        BenchStats inlined = bench_measure(run_i64_inlined, &ctx64, 10, samples);
+        BenchStats via_bsearch = bench_measure(run_i64_bsearch, &ctx64, 10, samples);
+        bench_print("worst case (i64 inlined)", &inlined);
+        bench_print("worst case (i64 bsearch)", &via_bsearch);
+
+        free(arr64);
     }
 
     free(large_arr);
 }
 
+// h3 -- Threaded Benchmark Argument Structure
+// h4 -- Per-thread input (shared array, probe count, private RNG seed) and
+// h4 -- output (per-thread latency percentiles and hit count)
+typedef struct
+{
+    int *arr;          // Shared read-only sorted array all threads probe
+    int size;          // Number of elements in the array
+    int probes;        // Independent probes this thread issues
+    unsigned int seed; // Private rand_r() seed so threads don't correlate
+    double p50_ns;     // Median per-probe latency (nanoseconds)
+    double p99_ns;     // 99th-percentile per-probe latency (nanoseconds)
+    int found_count;   // Probes that hit, for sanity checking
+} ThreadBenchArg;
+
+// h3 -- Threaded Benchmark Worker
+// h4 -- Issues independent random probes against the shared sorted array,
+// h4 -- timing each one through the shared harness for per-thread percentiles
+static void *threaded_bench_worker(void *arg)
+{
+    ThreadBenchArg *bench = (ThreadBenchArg *)arg;
+    double *latencies = (double *)malloc(bench->probes * sizeof(double));
+    if (latencies == NULL)
+    {
+        bench->p50_ns = bench->p99_ns = 0.0;
+        return NULL;
+    }
+
+    for (int p = 0; p < bench->probes; p++)
+    {
+        // Random value in range: even values hit, odd values miss
+        int target = (int)(rand_r(&bench->seed) % (unsigned int)(bench->size * 2));
+
+        double start = bench_now_ns();
+        int result = binary_search(bench->arr, bench->size, target);
+        BENCH_DO_NOT_OPTIMIZE(result);
+        latencies[p] = bench_now_ns() - start;
+
+        if (result != -1)
+        {
+            bench->found_count++;
+        }
+    }
+
+    BenchStats stats = bench_stats_from_samples(latencies, bench->probes);
+    bench->p50_ns = stats.median_ns;
+    bench->p99_ns = stats.p99_ns;
+
+    free(latencies);
+    return NULL;
+}
+
+// h3 -- Threaded Performance Test Function
+// h4 -- Spawns N pthreads issuing independent probes against one shared
+// h4 -- sorted array, reporting aggregate throughput and the spread of
+// h4 -- per-thread latency percentiles as reader count grows
+// h5 -- size: Size of the shared sorted test array
+// h5 -- nthreads: Number of concurrent reader threads to spawn
+void threaded_performance_test(int size, int nthreads)
+{
+    if (size <= 0 || nthreads <= 0)
+    {
+        printf("Invalid threaded test parameters: size=%d nthreads=%d\n", size, nthreads);
+        return;
+    }
+
+    int *shared_arr = (int *)malloc(size * sizeof(int));
+    if (shared_arr == NULL)
+    {
+        printf("Memory allocation failed for size %d!\n", size);
+        return;
+    }
+    for (int i = 0; i < size; i++)
+    {
+        shared_arr[i] = i * 2; // Same even-number fill as the single-threaded test
+    }
+
+    const int probes_per_thread = 100000;
+    pthread_t *threads = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    ThreadBenchArg *args = (ThreadBenchArg *)malloc(nthreads * sizeof(ThreadBenchArg));
+    if (threads == NULL || args == NULL)
+    {
+        printf("Memory allocation failed for %d threads!\n", nthreads);
+        free(threads);
+        free(args);
+        free(shared_arr);
+        return;
+    }
+
+    double wall_start = bench_now_ns();
+
+    for (int t = 0; t < nthreads; t++)
+    {
+        args[t].arr = shared_arr;
+        args[t].size = size;
+        args[t].probes = probes_per_thread;
+        args[t].seed = (unsigned int)(t * 7919 + 1); // Fixed seeds: reproducible
+        args[t].found_count = 0;
+        pthread_create(&threads[t], NULL, threaded_bench_worker, &args[t]);
+    }
+    for (int t = 0; t < nthreads; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    double wall_sec = (bench_now_ns() - wall_start) / 1e9;
+
+    // Aggregate throughput and the best/worst thread percentiles
+    double min_p50 = args[0].p50_ns, max_p50 = args[0].p50_ns;
+    double min_p99 = args[0].p99_ns, max_p99 = args[0].p99_ns;
+    for (int t = 1; t < nthreads; t++)
+    {
+        if (args[t].p50_ns < min_p50) min_p50 = args[t].p50_ns;
+        if (args[t].p50_ns > max_p50) max_p50 = args[t].p50_ns;
+        if (args[t].p99_ns < min_p99) min_p99 = args[t].p99_ns;
+        if (args[t].p99_ns > max_p99) max_p99 = args[t].p99_ns;
+    }
+    double total_probes = (double)nthreads * probes_per_thread;
+
+    printf("  %2d threads: %10.0f lookups/sec, p50 %.0f-%.0f ns, p99 %.0f-%.0f ns\n",
+           nthreads, total_probes / wall_sec, min_p50, max_p50, min_p99, max_p99);
+
+    free(threads);
+    free(args);
+    free(shared_arr);
+}
+
+// h3 -- Keyed Record Search (validation fixture)
+// h4 -- Demonstrates the key-extractor hook: a struct record array searched
+// h4 -- by its 64-bit key with the extraction inlined into the loop
+typedef struct
+{
+    long long key; // Sort key
+    int payload;   // Carried value, untouched by the search
+} Record;
+
+#define RECORD_KEY(r) ((r)->key)
+DEFINE_BINARY_SEARCH_BY_KEY(binary_search_record, Record, long long, RECORD_KEY)
+
 // h3 -- Validation Test Function
 // h4 -- Tests binary search with various test cases
 void validation_tests()
@@ -145,6 +999,625 @@ void validation_tests()
     int *empty_arr = NULL;
     int result7 = binary_search(empty_arr, 0, 5);
     printf("  Search in empty array: index %d (expected: -1)\n", result7);
+
+    // Test case 8: Batch API must agree with per-call searches
+    // Unsorted probe order with hits, misses, and a duplicate probe
+    int batch_targets[] = {14, 5, 2, 10, 99, 2, 8};
+    int batch_results[7];
+    binary_search_batch(arr1, size1, batch_targets, 7, batch_results);
+    int batch_mismatches = 0;
+    for (int i = 0; i < 7; i++)
+    {
+        if (batch_results[i] != binary_search(arr1, size1, batch_targets[i]))
+        {
+            batch_mismatches++;
+        }
+    }
+    printf("  Batch vs single-call agreement over 7 probes: %d mismatches (expected: 0)\n",
+           batch_mismatches);
+
+    // Test case 9: Branchless variant must agree with the branching one
+    // Probes every value in and around the array, plus single/empty arrays
+    int branchless_mismatches = 0;
+    for (int t = 0; t <= 16; t++)
+    {
+        if (binary_search_branchless(arr1, size1, t) != binary_search(arr1, size1, t))
+        {
+            branchless_mismatches++;
+        }
+    }
+    if (binary_search_branchless(single_arr, 1, 42) != 0)
+        branchless_mismatches++;
+    if (binary_search_branchless(empty_arr, 0, 5) != -1)
+        branchless_mismatches++;
+    printf("  Branchless vs branching agreement over 19 probes: %d mismatches (expected: 0)\n",
+           branchless_mismatches);
+
+    // Test case 10: Interpolation search must agree with binary search on
+    // every probe in and around the array, plus single/empty/flat arrays
+    int interp_mismatches = 0;
+    for (int t = 0; t <= 16; t++)
+    {
+        if (interpolation_search(arr1, size1, t) != binary_search(arr1, size1, t))
+        {
+            interp_mismatches++;
+        }
+    }
+    if (interpolation_search(single_arr, 1, 42) != 0)
+        interp_mismatches++;
+    if (interpolation_search(empty_arr, 0, 5) != -1)
+        interp_mismatches++;
+    int flat_arr[] = {7, 7, 7, 7}; // All-equal run: exercises the div-by-zero guard
+    if (interpolation_search(flat_arr, 4, 7) == -1)
+        interp_mismatches++;
+    if (interpolation_search(flat_arr, 4, 8) != -1)
+        interp_mismatches++;
+    printf("  Interpolation vs binary agreement over 21 probes: %d mismatches (expected: 0)\n",
+           interp_mismatches);
+
+    // Test case 11: Eytzinger layout must find exactly the values binary
+    // search finds, and the index it returns must hold the target value
+    int eyt_arr1[7];
+    eytzinger_build(arr1, eyt_arr1, size1);
+    int eyt_mismatches = 0;
+    for (int t = 0; t <= 16; t++)
+    {
+        int eyt_idx = eytzinger_search(eyt_arr1, size1, t);
+        int bin_idx = binary_search(arr1, size1, t);
+        if ((eyt_idx == -1) != (bin_idx == -1))
+            eyt_mismatches++;
+        else if (eyt_idx != -1 && eyt_arr1[eyt_idx] != t)
+            eyt_mismatches++;
+    }
+    printf("  Eytzinger vs binary agreement over 17 probes: %d mismatches (expected: 0)\n",
+           eyt_mismatches);
+
+    // Test case 12: Generic specializations - 64-bit keys and struct records
+    long long arr64[] = {2, 4, 6, 8, 10, 12, 14};
+    int generic_mismatches = 0;
+    for (int t = 0; t <= 16; t++)
+    {
+        if (binary_search_i64(arr64, 7, t) != binary_search(arr1, size1, t))
+            generic_mismatches++;
+    }
+    Record records[] = {{2, 20}, {4, 40}, {6, 60}, {8, 80}, {10, 100}, {12, 120}, {14, 140}};
+    for (int t = 0; t <= 16; t++)
+    {
+        if (binary_search_record(records, 7, t) != binary_search(arr1, size1, t))
+            generic_mismatches++;
+    }
+    printf("  Generic i64/record vs int agreement over 34 probes: %d mismatches (expected: 0)\n",
+           generic_mismatches);
+
+    // Test case 13: Bounds on a duplicate-heavy array
+    int dup_arr[] = {2, 4, 4, 4, 6, 8, 8};
+    int first, last;
+    printf("  lower_bound for 4 in [2,4,4,4,6,8,8]: index %d (expected: 1)\n",
+           lower_bound(dup_arr, 7, 4));
+    printf("  upper_bound for 4 in [2,4,4,4,6,8,8]: index %d (expected: 4)\n",
+           upper_bound(dup_arr, 7, 4));
+    equal_range(dup_arr, 7, 4, &first, &last);
+    printf("  equal_range for 4: [%d, %d) = %d occurrences (expected: 3)\n",
+           first, last, last - first);
+    equal_range(dup_arr, 7, 5, &first, &last);
+    printf("  equal_range for 5 (absent): [%d, %d) = %d occurrences (expected: 0)\n",
+           first, last, last - first);
+    printf("  lower_bound for 1 (before all): index %d (expected: 0)\n",
+           lower_bound(dup_arr, 7, 1));
+    printf("  upper_bound for 9 (after all): index %d (expected: 7)\n",
+           upper_bound(dup_arr, 7, 9));
+    printf("  lower_bound in empty array: index %d (expected: 0)\n",
+           lower_bound(empty_arr, 0, 5));
+
+    // Test case 14: Sorted checks - full scan and randomized spot-check
+    int sorted_check[32];
+    for (int i = 0; i < 32; i++)
+        sorted_check[i] = i; // Strictly ascending
+    printf("  is_sorted_full on sorted array: %d (expected: 1)\n",
+           is_sorted_full(sorted_check, 32));
+    sorted_check[17] = 0; // Inversion in the SIMD body
+    printf("  is_sorted_full after breaking index 17: %d (expected: 0)\n",
+           is_sorted_full(sorted_check, 32));
+    sorted_check[17] = 17;
+    sorted_check[31] = 0; // Inversion in the scalar tail
+    printf("  is_sorted_full after breaking last pair: %d (expected: 0)\n",
+           is_sorted_full(sorted_check, 32));
+    sorted_check[31] = 31;
+    printf("  is_sorted_sample on sorted array: %d (expected: 1)\n",
+           is_sorted_sample(sorted_check, 32, 16, 42));
+    int reversed_check[32];
+    for (int i = 0; i < 32; i++)
+        reversed_check[i] = 32 - i; // Every adjacent pair inverted
+    printf("  is_sorted_sample on reversed array: %d (expected: 0)\n",
+           is_sorted_sample(reversed_check, 32, 16, 42));
+
+    // Test case 15: K-way pipelined search must agree with per-call searches
+    // for every lane, including a partial final group and an empty array
+    int kway_arr[37];
+    for (int i = 0; i < 37; i++)
+        kway_arr[i] = i * 2; // Even values 0..72
+    int kway_targets[21], kway_results[21];
+    for (int i = 0; i < 21; i++)
+        kway_targets[i] = i * 7 - 3; // Mix of hits, misses, out-of-range
+    binary_search_kway(kway_arr, 37, kway_targets, 21, kway_results);
+    int kway_mismatches = 0;
+    for (int i = 0; i < 21; i++)
+    {
+        if (kway_results[i] != binary_search(kway_arr, 37, kway_targets[i]))
+        {
+            kway_mismatches++;
+        }
+    }
+    printf("  K-way vs single-call agreement over 21 probes: %d mismatches (expected: 0)\n",
+           kway_mismatches);
+    binary_search_kway(kway_arr, 0, kway_targets, 3, kway_results);
+    printf("  K-way on empty array: [%d, %d, %d] (expected: [-1, -1, -1])\n",
+           kway_results[0], kway_results[1], kway_results[2]);
+
+    // Test case 16: Sorted batch insert and the two-level table
+    int merge_arr[16] = {2, 4, 6, 8}; // Capacity 16, 4 elements used
+    int merge_delta[3] = {1, 5, 9};
+    int merged_count = sorted_insert_batch(merge_arr, 4, merge_delta, 3);
+    printf("  Batch merge count: %d (expected: 7)\n", merged_count);
+    printf("  Batch merge sorted: %d (expected: 1)\n",
+           is_sorted_full(merge_arr, merged_count));
+    printf("  Batch merge ends: [%d ... %d] (expected: [1 ... 9])\n",
+           merge_arr[0], merge_arr[merged_count - 1]);
+    int empty_main[4];
+    printf("  Merge into empty array count: %d (expected: 3)\n",
+           sorted_insert_batch(empty_main, 0, merge_delta, 3));
+    printf("  Merge of empty delta count: %d (expected: 7)\n",
+           sorted_insert_batch(merge_arr, merged_count, merge_delta, 0));
+
+    int table_storage[64];
+    for (int i = 0; i < 20; i++)
+        table_storage[i] = i * 2; // Even values 0..38
+    TwoLevelTable table;
+    table_init(&table, table_storage, 64, 20, 8);
+    table_insert(&table, 7);
+    table_insert(&table, 3);
+    table_insert(&table, 41);
+    printf("  Table search in main (14): %d (expected: 7)\n",
+           table_search(&table, 14));
+    printf("  Table search in delta (7): %d (expected: >= 20, got %s)\n",
+           table_search(&table, 7),
+           table_search(&table, 7) >= 20 ? "delta hit" : "MISS");
+    printf("  Table search absent (5): %d (expected: -1)\n",
+           table_search(&table, 5));
+    table_merge(&table);
+    printf("  Table after merge: count %d, sorted %d, delta %d "
+           "(expected: 23, 1, 0)\n",
+           table.main_count, is_sorted_full(table.main_arr, table.main_count),
+           table.delta_count);
+    printf("  Table search after merge (7): %d (expected: %d)\n",
+           table_search(&table, 7), binary_search(table_storage, 23, 7));
+}
+
+// h3 -- Key/Value Record (array-of-structs layout)
+// h4 -- 4-byte key dragging a 60-byte payload: every probe step pulls a full
+// h4 -- cache line of payload through the hierarchy just to read the key
+typedef struct
+{
+    int key;          // Sort key
+    char payload[60]; // Carried value bytes, untouched during the search
+} KVRecord;
+
+#define KV_KEY(r) ((r)->key)
+DEFINE_BINARY_SEARCH_BY_KEY(binary_search_kv_aos, KVRecord, int, KV_KEY)
+
+// h3 -- Key/Value Benchmark Contexts
+// h4 -- Each timed call probes a fresh random key so cache behavior matches
+// h4 -- real probe streams rather than one permanently-hot path
+typedef struct
+{
+    KVRecord *records; // AoS table
+    int size;
+    unsigned int seed; // Advanced per call
+} KVAoSBenchCtx;
+
+typedef struct
+{
+    int *keys; // SoA: dense keys-only array; values live in a parallel array
+    int size;
+    unsigned int seed;
+} KVSoABenchCtx;
+
+static int run_kv_aos(void *ctx)
+{
+    KVAoSBenchCtx *c = (KVAoSBenchCtx *)ctx;
+    int target = (int)(rand_r(&c->seed) % (unsigned int)(c->size * 2));
+    return binary_search_kv_aos(c->records, c->size, target);
+}
+
+static int run_kv_soa(void *ctx)
+{
+    KVSoABenchCtx *c = (KVSoABenchCtx *)ctx;
+    int target = (int)(rand_r(&c->seed) % (unsigned int)(c->size * 2));
+    return binary_search(c->keys, c->size, target); // Index into the values array
+}
+
+// h3 -- Key/Value Layout Benchmark
+// h4 -- Same records, same probes, two layouts: array-of-structs searched
+// h4 -- through the keyed specialization vs a structure-of-arrays split
+// h4 -- where binary_search() walks a dense keys array and the returned
+// h4 -- index points into a parallel values array
+// h5 -- size: Number of key/value records to build
+void kv_layout_benchmark(int size)
+{
+    KVRecord *records = (KVRecord *)malloc((size_t)size * sizeof(KVRecord));
+    int *keys = (int *)malloc((size_t)size * sizeof(int));
+    KVRecord *values = records; // SoA reuses the records as its values array
+    if (records == NULL || keys == NULL)
+    {
+        printf("Memory allocation failed for size %d!\n", size);
+        free(records);
+        free(keys);
+        return;
+    }
+
+    for (int i = 0; i < size; i++)
+    {
+        records[i].key = i * 2; // Even numbers, matching performance_test()
+        records[i].payload[0] = (char)i;
+        keys[i] = i * 2;
+    }
+
+    // Both layouts must return the same index for the same probe
+    int layout_mismatches = 0;
+    for (int t = 0; t <= 20; t++)
+    {
+        if (binary_search_kv_aos(records, size, t) != binary_search(keys, size, t))
+        {
+            layout_mismatches++;
+        }
+    }
+
+    printf("Key/Value Layout Test (Size: %d, %zu-byte records):\n",
+           size, sizeof(KVRecord));
+    printf("  AoS vs SoA agreement over 21 probes: %d mismatches (expected: 0)\n",
+           layout_mismatches);
+
+    KVAoSBenchCtx aos_ctx = {records, size, 1};
+    KVSoABenchCtx soa_ctx = {keys, size, 1}; // Same seed: identical probe stream
+    BenchStats aos = bench_measure(run_kv_aos, &aos_ctx, 100, 10000);
+    BenchStats soa = bench_measure(run_kv_soa, &soa_ctx, 100, 10000);
+    bench_print("AoS (key inside record)", &aos);
+    bench_print("SoA (dense keys array) ", &soa);
+    BENCH_DO_NOT_OPTIMIZE(values[0].payload[0]);
+
+    free(records);
+    free(keys);
+}
+
+// h3 -- Distribution Benchmark Context
+// h4 -- Cycles through a pre-generated probe stream so the probe distribution
+// h4 -- itself comes from the dataset module and is reproducible
+typedef struct
+{
+    int (*fn)(int[], int, int); // Search variant under test
+    int *arr;
+    int size;
+    const int *probes; // Pre-generated targets
+    int nprobes;
+    int cursor; // Advanced per call, wraps around
+} DistBenchCtx;
+
+static int run_dist_once(void *ctx)
+{
+    DistBenchCtx *c = (DistBenchCtx *)ctx;
+    int target = c->probes[c->cursor];
+    c->cursor = (c->cursor + 1) % c->nprobes;
+    return c->fn(c->arr, c->size, target);
+}
+
+// h3 -- Distribution Sensitivity Benchmark
+// h4 -- The sequential fills elsewhere in this file are the best case for
+// h4 -- every variant; this block runs the same searches over generated
+// h4 -- datasets to show how each variant degrades (or does not) on the
+// h4 -- inputs production actually serves
+void distribution_benchmark(int size)
+{
+    const int nprobes = 4096;
+    int *arr = (int *)malloc((size_t)size * sizeof(int));
+    int *probes = (int *)malloc((size_t)nprobes * sizeof(int));
+    if (arr == NULL || probes == NULL)
+    {
+        printf("Memory allocation failed for size %d!\n", size);
+        free(arr);
+        free(probes);
+        return;
+    }
+
+    printf("Distribution Sensitivity Test (Size: %d, %d-probe streams):\n",
+           size, nprobes);
+
+    // h4 -- Uniform-random sorted data, uniform probes: the realistic baseline
+    dataset_uniform(arr, size, size * 2, 101);
+    dataset_sort_ascending(arr, size);
+    dataset_uniform(probes, nprobes, size * 2, 202);
+
+    DistBenchCtx ctx = {binary_search, arr, size, probes, nprobes, 0};
+    BenchStats stats = bench_measure(run_dist_once, &ctx, 100, 10000);
+    bench_print("uniform data, binary       ", &stats);
+    ctx.fn = interpolation_search;
+    ctx.cursor = 0;
+    stats = bench_measure(run_dist_once, &ctx, 100, 10000);
+    bench_print("uniform data, interpolation", &stats);
+
+    // h4 -- Zipf-skewed probes against the same array: hot keys keep their
+    // h4 -- whole root-to-leaf path cached, so the same algorithm gets faster
+    int *zipf_ranks = (int *)malloc((size_t)nprobes * sizeof(int));
+    if (zipf_ranks != NULL)
+    {
+        dataset_zipfian(zipf_ranks, nprobes, size, 1.0, 303);
+        for (int i = 0; i < nprobes; i++)
+        {
+            probes[i] = arr[zipf_ranks[i]]; // Rank picks which element is hot
+        }
+        ctx.fn = binary_search;
+        ctx.cursor = 0;
+        stats = bench_measure(run_dist_once, &ctx, 100, 10000);
+        bench_print("zipf probes, binary        ", &stats);
+        free(zipf_ranks);
+    }
+
+    // h4 -- Duplicate-heavy sorted data: long equal runs, few distinct keys
+    dataset_duplicate_heavy(arr, size, 100, 404);
+    dataset_sort_ascending(arr, size);
+    dataset_uniform(probes, nprobes, 200, 505); // Half hit one of the 100 keys
+    ctx.fn = binary_search;
+    ctx.cursor = 0;
+    stats = bench_measure(run_dist_once, &ctx, 100, 10000);
+    bench_print("dup-heavy data, binary     ", &stats);
+
+    // h4 -- Adversarial data for interpolation: one outlier stretches the
+    // h4 -- value range so the position estimate is always ~0 and the search
+    // h4 -- slides toward O(n); binary search does not care
+    dataset_interpolation_adversarial(arr, size);
+    dataset_uniform(probes, nprobes, size - 1, 606); // Dense in-range targets
+    ctx.fn = binary_search;
+    ctx.cursor = 0;
+    stats = bench_measure(run_dist_once, &ctx, 100, 10000);
+    bench_print("adversarial, binary        ", &stats);
+    ctx.fn = interpolation_search;
+    ctx.cursor = 0;
+    stats = bench_measure(run_dist_once, &ctx, 10, 200); // Each call is O(n)
+    bench_print("adversarial, interpolation ", &stats);
+
+    free(arr);
+    free(probes);
+}
+
+// h3 -- Table Benchmark Context and Callback
+typedef struct
+{
+    const TwoLevelTable *table;
+    int target;
+} TableBenchCtx;
+
+static int run_table_search_once(void *ctx)
+{
+    TableBenchCtx *c = (TableBenchCtx *)ctx;
+    return table_search(c->table, c->target);
+}
+
+// h3 -- Update Ingest Benchmark
+// h4 -- The cost of absorbing k inserts into a sorted table of n elements:
+// h4 -- append-and-re-sort (what the serving path does today) vs one
+// h4 -- backward merge pass, plus the read-side price of the two-level
+// h4 -- search while a delta is outstanding
+// h5 -- size: Elements in the main table
+// h5 -- k: Batch of inserts to absorb
+void update_ingest_benchmark(int size, int k)
+{
+    int *resort_arr = (int *)malloc(((size_t)size + k) * sizeof(int));
+    int *merge_arr = (int *)malloc(((size_t)size + k) * sizeof(int));
+    int *delta = (int *)malloc((size_t)k * sizeof(int));
+    if (resort_arr == NULL || merge_arr == NULL || delta == NULL)
+    {
+        printf("Memory allocation failed for size %d!\n", size);
+        free(resort_arr);
+        free(merge_arr);
+        free(delta);
+        return;
+    }
+
+    for (int i = 0; i < size; i++)
+    {
+        resort_arr[i] = i * 2; // Even numbers, matching performance_test()
+        merge_arr[i] = i * 2;
+    }
+    dataset_uniform(delta, k, size * 2, 707); // Random values over the range
+    dataset_sort_ascending(delta, k);
+
+    printf("Ingest of %d inserts into %d elements:\n", k, size);
+
+    // The serving path today: append the batch and re-sort everything
+    double start = bench_now_ns();
+    for (int i = 0; i < k; i++)
+    {
+        resort_arr[size + i] = delta[i];
+    }
+    dataset_sort_ascending(resort_arr, size + k);
+    double resort_ns = bench_now_ns() - start;
+    BENCH_DO_NOT_OPTIMIZE(resort_arr[0]);
+
+    // One backward merge pass over the same data
+    start = bench_now_ns();
+    int merged_count = sorted_insert_batch(merge_arr, size, delta, k);
+    double merge_ns = bench_now_ns() - start;
+    BENCH_DO_NOT_OPTIMIZE(merge_arr[0]);
+
+    // Both must produce the identical sorted array
+    int ingest_mismatches = 0;
+    for (int i = 0; i < merged_count; i++)
+    {
+        if (merge_arr[i] != resort_arr[i])
+        {
+            ingest_mismatches++;
+        }
+    }
+    printf("  append + re-sort:    %.2f ms\n", resort_ns / 1e6);
+    printf("  backward merge pass: %.2f ms\n", merge_ns / 1e6);
+    printf("  result agreement: %d mismatches over %d elements (expected: 0)\n",
+           ingest_mismatches, merged_count);
+
+    // Read-side price of the two-level mode: a miss probes both levels,
+    // which is the worst case while a delta is outstanding
+    TwoLevelTable table;
+    table_init(&table, merge_arr, size + k, merged_count, TWO_LEVEL_DELTA_CAP);
+    for (int i = 0; i < TWO_LEVEL_DELTA_CAP / 2; i++)
+    {
+        table_insert(&table, i * 2 + 1); // Odd values stay in the delta
+    }
+
+    SearchBenchCtx flat_ctx = {binary_search, merge_arr, merged_count, -1};
+    BenchStats flat = bench_measure(run_search_once, &flat_ctx, 100, 10000);
+    TableBenchCtx table_ctx = {&table, -1};
+    BenchStats two_level = bench_measure(run_table_search_once, &table_ctx, 100, 10000);
+    bench_print("miss, main only        ", &flat);
+    bench_print("miss, main + half delta", &two_level);
+
+    free(resort_arr);
+    free(merge_arr);
+    free(delta);
+}
+
+// h3 -- Sorted Array File Writer
+// h4 -- Persists a sorted (or Eytzinger-order) int array as a raw binary
+// h4 -- file: no header, element count = file size / sizeof(int), so the
+// h4 -- searcher can map it zero-copy and search it demand-paged
+// h5 -- path: Output file path
+// h5 -- count: Number of elements (even-number scheme, same as the tests)
+// h5 -- eytzinger: Nonzero writes BFS order for eytzinger_search()
+// h6 -- Returns: 0 on success, -1 on failure
+// h6 -- Note: Builds the array in memory first; fine for the sizes this
+// h6 -- demo writes, production tables are produced by the ingest pipeline
+int write_sorted_array_file(const char *path, int count, int eytzinger)
+{
+    if (count <= 0)
+    {
+        fprintf(stderr, "Invalid element count: %d\n", count);
+        return -1;
+    }
+
+    int *arr = (int *)malloc((size_t)count * sizeof(int));
+    if (arr == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for %d elements\n", count);
+        return -1;
+    }
+    for (int i = 0; i < count; i++)
+    {
+        arr[i] = i * 2; // Even numbers, matching performance_test()
+    }
+
+    int *out = arr;
+    int *eyt = NULL;
+    if (eytzinger)
+    {
+        eyt = (int *)malloc((size_t)count * sizeof(int));
+        if (eyt == NULL)
+        {
+            fprintf(stderr, "Memory allocation failed for %d elements\n", count);
+            free(arr);
+            return -1;
+        }
+        eytzinger_build(arr, eyt, count);
+        out = eyt;
+    }
+
+    FILE *f = fopen(path, "wb");
+    if (f == NULL)
+    {
+        perror("fopen");
+        free(arr);
+        free(eyt);
+        return -1;
+    }
+    size_t written = fwrite(out, sizeof(int), (size_t)count, f);
+    fclose(f);
+    free(arr);
+    free(eyt);
+
+    if (written != (size_t)count)
+    {
+        fprintf(stderr, "Short write: %zu of %d elements\n", written, count);
+        return -1;
+    }
+    printf("Wrote %d %s-order elements (%zu bytes) to %s\n", count,
+           eytzinger ? "eytzinger" : "sorted", (size_t)count * sizeof(int), path);
+    return 0;
+}
+
+// h3 -- Memory-Mapped Search Mode
+// h4 -- Maps a persisted array file and searches it in place: zero-copy,
+// h4 -- demand-paged, no load or fill cost, datasets bounded by address
+// h4 -- space rather than RAM
+// h5 -- path: File produced by write_sorted_array_file()
+// h5 -- target: Value to search for
+// h5 -- eytzinger: Nonzero treats the file as BFS order
+// h6 -- Returns: 0 on success (found or not), -1 on failure to map
+int mmap_search_mode(const char *path, int target, int eytzinger)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        perror("open");
+        return -1;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0)
+    {
+        perror("fstat");
+        close(fd);
+        return -1;
+    }
+    int count = (int)(st.st_size / (off_t)sizeof(int));
+    if (count <= 0)
+    {
+        fprintf(stderr, "File %s holds no elements\n", path);
+        close(fd);
+        return -1;
+    }
+
+    int *arr = (int *)mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (arr == MAP_FAILED)
+    {
+        perror("mmap");
+        close(fd);
+        return -1;
+    }
+    close(fd); // The mapping keeps the file open
+
+    double start = bench_now_ns();
+    int result = eytzinger ? eytzinger_search(arr, count, target)
+                           : binary_search(arr, count, target);
+    BENCH_DO_NOT_OPTIMIZE(result);
+    double cold_ns = bench_now_ns() - start;
+
+    start = bench_now_ns();
+    int warm_result = eytzinger ? eytzinger_search(arr, count, target)
+                                : binary_search(arr, count, target);
+    BENCH_DO_NOT_OPTIMIZE(warm_result);
+    double warm_ns = bench_now_ns() - start;
+
+    printf("Mapped %d elements from %s (%s layout)\n", count, path,
+           eytzinger ? "eytzinger" : "sorted");
+    if (result != -1)
+    {
+        printf("Found %d at index %d\n", target, result);
+    }
+    else
+    {
+        printf("%d not found\n", target);
+    }
+    printf("Cold (page-faulting) search: %.0f ns, warm search: %.0f ns\n",
+           cold_ns, warm_ns);
+
+    munmap(arr, (size_t)st.st_size);
+    return 0;
 }
 
 // h3 -- Print Array Helper Function
@@ -163,8 +1636,33 @@ void print_array(int arr[], int size)
     printf("]");
 }
 
-int main()
+int main(int argc, char *argv[])
 {
+    // h3 -- Command-Line Modes (memory-mapped datasets)
+    // h4 -- write <file> <count> [eyt]  - persist a sorted/BFS array file
+    // h4 -- search <file> <target> [eyt] - mmap the file and search in place
+    // h4 -- No arguments runs the usual demo and benchmarks
+    if (argc >= 2 && strcmp(argv[1], "write") == 0)
+    {
+        if (argc < 4)
+        {
+            fprintf(stderr, "Usage: %s write <file> <count> [eyt]\n", argv[0]);
+            return 1;
+        }
+        int eyt = (argc > 4 && strcmp(argv[4], "eyt") == 0);
+        return write_sorted_array_file(argv[2], atoi(argv[3]), eyt) == 0 ? 0 : 1;
+    }
+    if (argc >= 2 && strcmp(argv[1], "search") == 0)
+    {
+        if (argc < 4)
+        {
+            fprintf(stderr, "Usage: %s search <file> <target> [eyt]\n", argv[0]);
+            return 1;
+        }
+        int eyt = (argc > 4 && strcmp(argv[4], "eyt") == 0);
+        return mmap_search_mode(argv[2], atoi(argv[3]), eyt) == 0 ? 0 : 1;
+    }
+
     printf("=== BINARY SEARCH ALGORITHM - C IMPLEMENTATION ===\n\n");
 
     // h3 -- Basic Functionality Test
@@ -201,7 +1699,8 @@ int main()
     // h4 -- Measure performance with different array sizes
     printf("\n\n3. PERFORMANCE TESTS\n");
     printf("===================\n");
-    printf("Note: Testing 10,000 iterations per case\n");
+    printf("Note: 10,000 timed samples per case via the shared harness\n");
+    printf("      Times are per-call nanoseconds (CLOCK_MONOTONIC)\n");
     printf("      Array contains even numbers [0, 2, 4, ...]\n\n");
 
     // Test with different array sizes
@@ -210,6 +1709,42 @@ int main()
     performance_test(100000);  // 100K elements
     performance_test(1000000); // 1M elements
 
+    // h3 -- Key/Value Layout Comparison
+    // h4 -- Array-of-structs vs structure-of-arrays at the 1M-element size
+    printf("\n\n3a. KEY/VALUE LAYOUT COMPARISON\n");
+    printf("===============================\n");
+    printf("Note: Random probes; AoS drags payload bytes through cache,\n");
+    printf("      SoA searches a dense keys-only array\n\n");
+    kv_layout_benchmark(1000000);
+
+    // h3 -- Threaded Performance Tests
+    // h4 -- Concurrent readers against one shared sorted array
+    printf("\n\n3b. THREADED PERFORMANCE TESTS\n");
+    printf("==============================\n");
+    printf("Note: %d random probes per thread against a shared 1M array\n", 100000);
+    printf("      Shows throughput scaling as reader count grows\n\n");
+
+    int thread_counts[] = {1, 2, 4, 8};
+    for (int t = 0; t < 4; t++)
+    {
+        threaded_performance_test(1000000, thread_counts[t]);
+    }
+
+    // h3 -- Dataset Distribution Sensitivity
+    // h4 -- Generated datasets instead of the friendly sequential fill
+    printf("\n\n3c. DATASET DISTRIBUTION SENSITIVITY\n");
+    printf("====================================\n");
+    printf("Note: Seeded generators from the shared dataset module\n\n");
+    distribution_benchmark(1000000);
+
+    // h3 -- Update-Friendly Ingest
+    // h4 -- Keeping the table binary-searchable while inserts trickle in
+    printf("\n\n3d. UPDATE-FRIENDLY INGEST (TWO-LEVEL TABLE)\n");
+    printf("============================================\n");
+    printf("Note: Batch merge vs full re-sort, and the read cost of the\n");
+    printf("      main + delta search while a delta is outstanding\n\n");
+    update_ingest_benchmark(1000000, 1000);
+
     // h3 -- Algorithm Analysis
     // h4 -- Educational summary of binary search characteristics
     printf("\n\n4. ALGORITHM ANALYSIS\n");
@@ -1,10 +1,22 @@
 // h1 -- Linear Search Algorithm Implementation in C
 // h2 -- Simple linear search that sequentially checks each element
 // h2 -- Includes proper performance timing and validation
+// h2 -- Build: gcc -O2 -Wall -Wextra linear_search.c ../bench/bench_timing.c ../bench/bench_datasets.c -o ls -lpthread -lm
 
 #include <stdio.h>
-#include <time.h>   // For clock() and timing functions
-#include <stdlib.h> // For rand() and srand()
+#include <time.h>    // For time() seeding
+#include <stdlib.h>  // For rand() and srand()
+#include <limits.h>  // For INT_MAX (parallel search sentinel)
+#include <pthread.h> // For threaded benchmark mode and parallel search (-lpthread)
+
+#include "../bench/bench_timing.h"   // Shared timing harness (warmup, min/median/p99)
+#include "../bench/bench_datasets.h" // Seeded dataset generators (compile with -lm)
+#include "search_generic.h"          // Type-generic specializations (i64 etc.)
+
+// h2 -- SIMD intrinsics (x86 only, guarded so other targets fall back to scalar code)
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 // h3 -- Linear Search Function
 // h4 -- Searches for target value in array by checking each element sequentially
@@ -30,10 +42,121 @@ int linear_search(int arr[], int size, int target)
     return -1; // Not found
 }
 
+// h3 -- SIMD Linear Search Function
+// h4 -- Same contract as linear_search() but compares many lanes per step
+// h4 -- AVX2: 8 ints per compare, SSE2: 4 ints per compare, otherwise scalar fallback
+// h5 -- arr[]: Integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to search for
+// h6 -- Returns: Index of FIRST occurrence if found, -1 if not found
+// h6 -- Time Complexity: O(n) - same as scalar, but with a much smaller constant
+// h6 -- Note: Uses unaligned loads so any int* is accepted
+int linear_search_simd(int arr[], int size, int target)
+{
+    // Handle empty array case immediately
+    if (size <= 0)
+    {
+        return -1;
+    }
+
+    int i = 0;
+
+#if defined(__AVX2__)
+    // Broadcast target into all 8 lanes once, outside the loop
+    __m256i vtarget = _mm256_set1_epi32(target);
+    for (; i + 8 <= size; i += 8)
+    {
+        __m256i chunk = _mm256_loadu_si256((const __m256i *)&arr[i]);
+        __m256i eq = _mm256_cmpeq_epi32(chunk, vtarget);
+        int mask = _mm256_movemask_ps(_mm256_castsi256_ps(eq));
+        if (mask != 0)
+        {
+            // Lowest set bit = first matching lane = first occurrence
+            return i + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__SSE2__)
+    // Broadcast target into all 4 lanes once, outside the loop
+    __m128i vtarget = _mm_set1_epi32(target);
+    for (; i + 4 <= size; i += 4)
+    {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)&arr[i]);
+        __m128i eq = _mm_cmpeq_epi32(chunk, vtarget);
+        int mask = _mm_movemask_ps(_mm_castsi128_ps(eq));
+        if (mask != 0)
+        {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#endif
+
+    // Scalar tail (or the whole array on non-x86 targets)
+    for (; i < size; i++)
+    {
+        if (arr[i] == target)
+            return i; // Found at index i
+    }
+    return -1; // Not found
+}
+
+// h3 -- Search Benchmark Context
+// h4 -- Bundles one search variant with its inputs for the timing harness
+typedef struct
+{
+    int (*fn)(int[], int, int); // Search variant under test
+    int *arr;                   // Array to probe
+    int size;                   // Number of elements
+    int target;                 // Probe value
+} SearchBenchCtx;
+
+// h3 -- Search Benchmark Callback
+// h4 -- One timed probe; returns the index so the harness can barrier it
+static int run_search_once(void *ctx)
+{
+    SearchBenchCtx *c = (SearchBenchCtx *)ctx;
+    return c->fn(c->arr, c->size, c->target);
+}
+
+// h3 -- Distribution Benchmark Context and Callback
+// h4 -- Cycles through a pre-generated probe stream so the probe distribution
+// h4 -- itself comes from the dataset module and is reproducible
+typedef struct
+{
+    int (*fn)(int[], int, int); // Search variant under test
+    int *arr;
+    int size;
+    const int *probes; // Pre-generated targets
+    int nprobes;
+    int cursor; // Advanced per call, wraps around
+} DistBenchCtx;
+
+static int run_dist_once(void *ctx)
+{
+    DistBenchCtx *c = (DistBenchCtx *)ctx;
+    int target = c->probes[c->cursor];
+    c->cursor = (c->cursor + 1) % c->nprobes;
+    return c->fn(c->arr, c->size, target);
+}
+
+// h3 -- 64-bit Benchmark Context and Callback
+// h4 -- Covers the 64-bit key case via the inlined generic specialization
+typedef struct
+{
+    long long *arr;   // 64-bit key array
+    int size;         // Number of elements
+    long long target; // Probe value
+} I64BenchCtx;
+
+static int run_i64_search_once(void *ctx)
+{
+    I64BenchCtx *c = (I64BenchCtx *)ctx;
+    return linear_search_i64(c->arr, c->size, c->target);
+}
+
 // h3 -- Performance Test Function
-// h4 -- Tests linear search performance with proper timing
+// h4 -- Tests linear search performance through the shared timing harness
 // h5 -- size: Size of test array to generate
-// h6 -- Uses multiple iterations for accurate timing
+// h6 -- Reports min/median/p99 over many timed samples per variant
 void performance_test(int size)
 {
     // Don't test with size 0
@@ -60,40 +183,373 @@ void performance_test(int size)
     // Set target to last element for worst-case scenario
     int target = size - 1;
 
-    // Warm up the cache (run a few times)
-    for (int warmup = 0; warmup < 10; warmup++)
+    // Both variants run the same worst-case probe so the numbers are comparable
+    int (*variants[])(int[], int, int) = {linear_search, linear_search_simd};
+    const char *variant_names[] = {"scalar", "SIMD  "};
+
+    printf("Performance Test (Size: %d):\n", size);
+    printf("  Target: %d (worst case - last element)\n", target);
+
+    // The harness handles warmup, per-sample timing, and the compiler barrier
+    const int samples = 1000;
+    for (int v = 0; v < 2; v++)
     {
-        linear_search(large_arr, size, target);
+        SearchBenchCtx ctx = {variants[v], large_arr, size, target};
+        BenchStats stats = bench_measure(run_search_once, &ctx, 10, samples);
+        bench_print(variant_names[v], &stats);
+        bench_print_throughput(variant_names[v], &stats, size,
+                               (double)size * sizeof(int));
+
+        BenchCounters counters = bench_count(run_search_once, &ctx, 200);
+        bench_print_counters(variant_names[v], &counters);
     }
 
-    // Time multiple iterations for accuracy
-    const int iterations = 1000;
-    clock_t total_time = 0;
-    int found_count = 0;
+    // 64-bit keys through the inlined generic specialization, same worst case
+    long long *arr64 = (long long *)malloc(size * sizeof(long long));
+    if (arr64 != NULL)
+    {
+        for (int i = 0; i < size; i++)
+        {
+            arr64[i] = i;
+        }
+        I64BenchCtx ctx64 = {arr64, size, size - 1};
+        BenchStats stats64 = bench_measure(run_i64_search_once, &ctx64, 10, samples);
+        bench_print("i64   ", &stats64);
+        free(arr64);
+    }
 
-    for (int iter = 0; iter < iterations; iter++)
+    free(large_arr);
+}
+
+// h3 -- Search Crossover Structure
+// h4 -- Host-measured size thresholds for the adaptive dispatcher; the
+// h4 -- defaults are only used if search_auto() runs before calibration
+typedef struct
+{
+    int scalar_to_simd; // At or above: SIMD linear beats scalar linear
+    int simd_to_binary; // At or above (sorted input): binary beats SIMD
+    int calibrated;     // Set once search_auto_calibrate() has run
+} SearchCrossover;
+
+static SearchCrossover search_crossover = {64, 256, 0};
+
+// h3 -- Calibration Benchmark Callback Context
+typedef struct
+{
+    int (*fn)(int[], int, int);
+    int *arr;
+    int size;
+    int target;
+} CalibrateCtx;
+
+static int run_calibrate_once(void *ctx)
+{
+    CalibrateCtx *c = (CalibrateCtx *)ctx;
+    return c->fn(c->arr, c->size, c->target);
+}
+
+static int binary_search_i32_adapter(int arr[], int size, int target)
+{
+    return binary_search_i32(arr, size, target); // Non-inline fn ptr target
+}
+
+// h3 -- Crossover Calibration Function
+// h4 -- Measures the actual scalar/SIMD/binary crossover points on THIS
+// h4 -- host at startup - they differ wildly between microarchitectures,
+// h4 -- so a hardcoded threshold is stale the day it is written
+// h4 -- Doubling sizes, worst-case (absent) probes, median-of-samples
+void search_auto_calibrate(void)
+{
+    const int max_size = 65536;
+    int *arr = (int *)malloc(max_size * sizeof(int));
+    if (arr == NULL)
+    {
+        search_crossover.calibrated = 1; // Keep the defaults
+        return;
+    }
+    for (int i = 0; i < max_size; i++)
+    {
+        arr[i] = i; // Sorted, so the same data serves all three kernels
+    }
+
+    int scalar_to_simd = max_size;
+    int simd_to_binary = max_size;
+
+    for (int size = 8; size <= max_size; size *= 2)
+    {
+        CalibrateCtx ctx = {linear_search, arr, size, -1};
+        BenchStats scalar = bench_measure(run_calibrate_once, &ctx, 20, 200);
+        ctx.fn = linear_search_simd;
+        BenchStats simd = bench_measure(run_calibrate_once, &ctx, 20, 200);
+        ctx.fn = binary_search_i32_adapter;
+        BenchStats binary = bench_measure(run_calibrate_once, &ctx, 20, 200);
+
+        if (scalar_to_simd == max_size && simd.median_ns < scalar.median_ns)
+        {
+            scalar_to_simd = size;
+        }
+        if (simd_to_binary == max_size && binary.median_ns < simd.median_ns)
+        {
+            simd_to_binary = size;
+        }
+    }
+
+    search_crossover.scalar_to_simd = scalar_to_simd;
+    search_crossover.simd_to_binary = simd_to_binary;
+    search_crossover.calibrated = 1;
+    free(arr);
+}
+
+// h3 -- Adaptive Search Dispatcher
+// h4 -- Routes each call to scalar linear, SIMD linear, or binary search
+// h4 -- from the array size and the caller's sortedness metadata, using the
+// h4 -- calibrated crossover points - call sites stop hand-picking kernels
+// h5 -- arr[]: Integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to search for
+// h5 -- sorted: Nonzero if the caller guarantees ascending order
+// h6 -- Returns: Index of target if found, -1 if not found
+// h6 -- Note: For sorted input every kernel returns the same index only
+// h6 -- when values are distinct; with duplicates binary search may return
+// h6 -- any index in the run, like binary_search() itself
+int search_auto(int arr[], int size, int target, int sorted)
+{
+    if (sorted && size >= search_crossover.simd_to_binary)
     {
-        clock_t start = clock();
-        int result = linear_search(large_arr, size, target);
-        clock_t end = clock();
-        total_time += (end - start);
+        return binary_search_i32(arr, size, target);
+    }
+    if (size >= search_crossover.scalar_to_simd)
+    {
+        return linear_search_simd(arr, size, target);
+    }
+    return linear_search(arr, size, target);
+}
+
+// h3 -- Parallel Search Worker Argument Structure
+// h4 -- One contiguous chunk of the array plus the shared best-index slot
+typedef struct
+{
+    int *arr;       // Shared array being scanned
+    int target;     // Value to search for
+    int chunk_start; // First index of this worker's chunk (inclusive)
+    int chunk_end;   // One past the last index of this worker's chunk
+    int *best_index; // Shared lowest-match-so-far, INT_MAX while unfound
+} ParallelSearchArg;
+
+// h3 -- Parallel Search Worker
+// h4 -- Scans one chunk, stopping early once an earlier chunk has a match
+// h4 -- (nothing this worker could find can beat a lower-chunk hit), and
+// h4 -- publishing its own first match via an atomic min-update
+static void *parallel_search_worker(void *arg)
+{
+    ParallelSearchArg *w = (ParallelSearchArg *)arg;
+
+    for (int i = w->chunk_start; i < w->chunk_end; i++)
+    {
+        // Poll the shared flag periodically, not per element - a relaxed
+        // load every 1K elements keeps the early-exit cheap
+        if (((i - w->chunk_start) & 1023) == 0)
+        {
+            int current = __atomic_load_n(w->best_index, __ATOMIC_RELAXED);
+            if (current < w->chunk_start)
+            {
+                return NULL; // An earlier chunk already won
+            }
+        }
+
+        if (w->arr[i] == w->target)
+        {
+            // Atomic min: only replace the shared index with a smaller one
+            int current = __atomic_load_n(w->best_index, __ATOMIC_RELAXED);
+            while (i < current &&
+                   !__atomic_compare_exchange_n(w->best_index, &current, i, 0,
+                                                __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                // current was refreshed by the failed CAS; retry if still smaller
+            }
+            return NULL; // First match in this chunk is its lowest
+        }
+    }
+    return NULL;
+}
+
+// h3 -- Parallel Linear Search Function
+// h4 -- Splits the array into nthreads contiguous chunks scanned concurrently
+// h4 -- A found-flag propagates between workers so later chunks stop early,
+// h4 -- while the lowest-matching-index guarantee of the sequential version
+// h4 -- is preserved (each chunk reports its first match; the minimum wins)
+// h5 -- arr[]: Integer array to search through
+// h5 -- size: Number of elements in the array
+// h5 -- target: Value to search for
+// h5 -- nthreads: Number of worker threads (<= 1 falls back to sequential)
+// h6 -- Returns: Index of first occurrence if found, -1 if not found
+// h6 -- Time Complexity: O(n / nthreads) until memory bandwidth saturates
+int linear_search_parallel(int arr[], int size, int target, int nthreads)
+{
+    if (size <= 0)
+    {
+        return -1;
+    }
+    if (nthreads <= 1 || size < nthreads)
+    {
+        return linear_search(arr, size, target);
+    }
+
+    pthread_t *threads = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    ParallelSearchArg *args = (ParallelSearchArg *)malloc(nthreads * sizeof(ParallelSearchArg));
+    if (threads == NULL || args == NULL)
+    {
+        free(threads);
+        free(args);
+        return linear_search(arr, size, target);
+    }
+
+    int best_index = INT_MAX;
+    int chunk = (size + nthreads - 1) / nthreads;
+
+    for (int t = 0; t < nthreads; t++)
+    {
+        args[t].arr = arr;
+        args[t].target = target;
+        args[t].chunk_start = t * chunk;
+        args[t].chunk_end = (t + 1) * chunk < size ? (t + 1) * chunk : size;
+        args[t].best_index = &best_index;
+        pthread_create(&threads[t], NULL, parallel_search_worker, &args[t]);
+    }
+    for (int t = 0; t < nthreads; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    free(threads);
+    free(args);
+    return (best_index == INT_MAX) ? -1 : best_index;
+}
+
+// h3 -- Threaded Benchmark Argument Structure
+// h4 -- Per-thread input (shared array, probe count, private RNG seed) and
+// h4 -- output (per-thread latency percentiles and hit count)
+typedef struct
+{
+    int *arr;           // Shared read-only array all threads probe
+    int size;           // Number of elements in the array
+    int probes;         // Independent probes this thread issues
+    unsigned int seed;  // Private rand_r() seed so threads don't correlate
+    double p50_ns;      // Median per-probe latency (nanoseconds)
+    double p99_ns;      // 99th-percentile per-probe latency (nanoseconds)
+    int found_count;    // Probes that hit, for sanity checking
+} ThreadBenchArg;
+
+// h3 -- Threaded Benchmark Worker
+// h4 -- Issues independent random probes against the shared array, timing
+// h4 -- each one through the shared harness so percentiles are meaningful
+static void *threaded_bench_worker(void *arg)
+{
+    ThreadBenchArg *bench = (ThreadBenchArg *)arg;
+    double *latencies = (double *)malloc(bench->probes * sizeof(double));
+    if (latencies == NULL)
+    {
+        bench->p50_ns = bench->p99_ns = 0.0;
+        return NULL;
+    }
+
+    for (int p = 0; p < bench->probes; p++)
+    {
+        // Half the probes miss (values >= size never occur in the array)
+        int target = (int)(rand_r(&bench->seed) % (unsigned int)(bench->size * 2));
+
+        double start = bench_now_ns();
+        int result = linear_search(bench->arr, bench->size, target);
+        BENCH_DO_NOT_OPTIMIZE(result);
+        latencies[p] = bench_now_ns() - start;
 
         if (result != -1)
         {
-            found_count++;
+            bench->found_count++;
         }
     }
 
-    double avg_cpu_time_used = ((double)total_time / iterations) / CLOCKS_PER_SEC;
+    BenchStats stats = bench_stats_from_samples(latencies, bench->probes);
+    bench->p50_ns = stats.median_ns;
+    bench->p99_ns = stats.p99_ns;
 
-    printf("Performance Test (Size: %d):\n", size);
-    printf("  Target: %d (worst case - last element)\n", target);
-    printf("  Average execution time: %.6f seconds\n", avg_cpu_time_used);
-    printf("  Time per element: %.9f seconds\n", avg_cpu_time_used / size);
-    printf("  Total iterations: %d\n", iterations);
-    printf("  Success rate: %d/%d\n", found_count, iterations);
+    free(latencies);
+    return NULL;
+}
 
-    free(large_arr);
+// h3 -- Threaded Performance Test Function
+// h4 -- Spawns N pthreads issuing independent probes against one shared array
+// h4 -- Reports aggregate throughput plus the spread of per-thread percentiles,
+// h4 -- showing how memory bandwidth saturates as reader count grows
+// h5 -- size: Size of the shared test array
+// h5 -- nthreads: Number of concurrent reader threads to spawn
+void threaded_performance_test(int size, int nthreads)
+{
+    if (size <= 0 || nthreads <= 0)
+    {
+        printf("Invalid threaded test parameters: size=%d nthreads=%d\n", size, nthreads);
+        return;
+    }
+
+    int *shared_arr = (int *)malloc(size * sizeof(int));
+    if (shared_arr == NULL)
+    {
+        printf("Memory allocation failed for size %d!\n", size);
+        return;
+    }
+    for (int i = 0; i < size; i++)
+    {
+        shared_arr[i] = i; // Same sequential fill as the single-threaded test
+    }
+
+    const int probes_per_thread = 200;
+    pthread_t *threads = (pthread_t *)malloc(nthreads * sizeof(pthread_t));
+    ThreadBenchArg *args = (ThreadBenchArg *)malloc(nthreads * sizeof(ThreadBenchArg));
+    if (threads == NULL || args == NULL)
+    {
+        printf("Memory allocation failed for %d threads!\n", nthreads);
+        free(threads);
+        free(args);
+        free(shared_arr);
+        return;
+    }
+
+    double wall_start = bench_now_ns();
+
+    for (int t = 0; t < nthreads; t++)
+    {
+        args[t].arr = shared_arr;
+        args[t].size = size;
+        args[t].probes = probes_per_thread;
+        args[t].seed = (unsigned int)(t * 7919 + 1); // Fixed seeds: reproducible
+        args[t].found_count = 0;
+        pthread_create(&threads[t], NULL, threaded_bench_worker, &args[t]);
+    }
+    for (int t = 0; t < nthreads; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    double wall_sec = (bench_now_ns() - wall_start) / 1e9;
+
+    // Aggregate throughput and the best/worst thread percentiles
+    double min_p50 = args[0].p50_ns, max_p50 = args[0].p50_ns;
+    double min_p99 = args[0].p99_ns, max_p99 = args[0].p99_ns;
+    for (int t = 1; t < nthreads; t++)
+    {
+        if (args[t].p50_ns < min_p50) min_p50 = args[t].p50_ns;
+        if (args[t].p50_ns > max_p50) max_p50 = args[t].p50_ns;
+        if (args[t].p99_ns < min_p99) min_p99 = args[t].p99_ns;
+        if (args[t].p99_ns > max_p99) max_p99 = args[t].p99_ns;
+    }
+    double total_probes = (double)nthreads * probes_per_thread;
+
+    printf("  %2d threads: %10.0f lookups/sec, p50 %.0f-%.0f ns, p99 %.0f-%.0f ns\n",
+           nthreads, total_probes / wall_sec, min_p50, max_p50, min_p99, max_p99);
+
+    free(threads);
+    free(args);
+    free(shared_arr);
 }
 
 // h3 -- Validate Search Function
@@ -133,6 +589,48 @@ void validate_search()
     int dup_arr[] = {1, 2, 3, 2, 1};
     int result7 = linear_search(dup_arr, 5, 2);
     printf("  Search for 2 in [1,2,3,2,1]: index %d (expected: 1)\n", result7);
+
+    // Test case 8: SIMD variant must agree with scalar on every probe above
+    // Includes a 19-element array so vector body, tail, and duplicates are all covered
+    int simd_arr[19];
+    for (int i = 0; i < 19; i++)
+    {
+        simd_arr[i] = i % 10; // Duplicates: first occurrence matters
+    }
+    int simd_mismatches = 0;
+    for (int t = -1; t <= 10; t++)
+    {
+        if (linear_search_simd(simd_arr, 19, t) != linear_search(simd_arr, 19, t))
+        {
+            simd_mismatches++;
+        }
+    }
+    printf("  SIMD vs scalar agreement over 12 probes: %d mismatches (expected: 0)\n",
+           simd_mismatches);
+
+    // Test case 9: Parallel search must return the same lowest index as the
+    // sequential version, including duplicates straddling chunk boundaries
+    int par_size = 10000;
+    int *par_arr = (int *)malloc(par_size * sizeof(int));
+    if (par_arr != NULL)
+    {
+        for (int i = 0; i < par_size; i++)
+        {
+            par_arr[i] = i % 100; // Every value repeats across all chunks
+        }
+        int par_mismatches = 0;
+        for (int t = -1; t <= 100; t += 10)
+        {
+            if (linear_search_parallel(par_arr, par_size, t, 4) !=
+                linear_search(par_arr, par_size, t))
+            {
+                par_mismatches++;
+            }
+        }
+        printf("  Parallel vs sequential agreement over 11 probes: %d mismatches (expected: 0)\n",
+               par_mismatches);
+        free(par_arr);
+    }
 }
 
 // h3 -- Empty Array Test (Separate function)
@@ -205,8 +703,8 @@ int main()
     printf("\n\n3. PERFORMANCE TESTS\n");
     printf("===================\n");
     printf("Note: Testing worst-case scenario (target at end)\n");
-    printf("      Averaging over 1000 iterations for accuracy\n");
-    printf("      CLOCKS_PER_SEC = %ld\n\n", CLOCKS_PER_SEC);
+    printf("      1000 timed samples per variant via the shared harness\n");
+    printf("      Times are per-call nanoseconds (CLOCK_MONOTONIC)\n\n");
 
     // Test with different array sizes
     performance_test(100);    // 100 elements
@@ -214,6 +712,126 @@ int main()
     performance_test(10000);  // 10K elements
     performance_test(100000); // 100K elements
 
+    // h3 -- Threaded Performance Tests
+    // h4 -- Concurrent readers against one shared array, scaling thread count
+    printf("\n\n3b. THREADED PERFORMANCE TESTS\n");
+    printf("==============================\n");
+    printf("Note: %d random probes per thread against a shared 100K array\n", 200);
+    printf("      Shows throughput scaling as reader count grows\n\n");
+
+    int thread_counts[] = {1, 2, 4, 8};
+    for (int t = 0; t < 4; t++)
+    {
+        threaded_performance_test(100000, thread_counts[t]);
+    }
+
+    // h3 -- Adaptive Dispatcher
+    // h4 -- Calibrate the crossover points on this host, then sanity-check
+    // h4 -- that dispatched searches agree with the underlying kernels
+    printf("\n\n3c. ADAPTIVE DISPATCHER CALIBRATION\n");
+    printf("===================================\n");
+    search_auto_calibrate();
+    printf("Measured crossover points on this host:\n");
+    printf("  scalar linear -> SIMD linear: %d elements\n",
+           search_crossover.scalar_to_simd);
+    printf("  SIMD linear -> binary (sorted input): %d elements\n",
+           search_crossover.simd_to_binary);
+
+    int auto_mismatches = 0;
+    int auto_sizes[] = {8, 100, 10000};
+    for (int s = 0; s < 3; s++)
+    {
+        int asize = auto_sizes[s];
+        int *auto_arr = (int *)malloc(asize * sizeof(int));
+        if (auto_arr == NULL)
+            continue;
+        for (int i = 0; i < asize; i++)
+        {
+            auto_arr[i] = i; // Sorted and distinct: all kernels agree exactly
+        }
+        for (int t = -1; t <= asize; t += (asize / 4) + 1)
+        {
+            if (search_auto(auto_arr, asize, t, 1) != linear_search(auto_arr, asize, t))
+                auto_mismatches++;
+            if (search_auto(auto_arr, asize, t, 0) != linear_search(auto_arr, asize, t))
+                auto_mismatches++;
+        }
+        free(auto_arr);
+    }
+    printf("Dispatcher vs linear_search agreement: %d mismatches (expected: 0)\n",
+           auto_mismatches);
+
+    // h3 -- Parallel Search Scaling
+    // h4 -- One not-found scan (full array touched) per thread count
+    printf("\n\n3d. PARALLEL SEARCH SCALING\n");
+    printf("===========================\n");
+    int par_size = 10000000;
+    int *par_arr = (int *)malloc(par_size * sizeof(int));
+    if (par_arr != NULL)
+    {
+        for (int i = 0; i < par_size; i++)
+        {
+            par_arr[i] = i;
+        }
+        printf("Not-found scan of %d elements (full array touched):\n", par_size);
+        for (int t = 0; t < 4; t++)
+        {
+            double start = bench_now_ns();
+            int result = linear_search_parallel(par_arr, par_size, -1, thread_counts[t]);
+            BENCH_DO_NOT_OPTIMIZE(result);
+            double elapsed = bench_now_ns() - start;
+            printf("  %d threads: %.3f ms (%.2f GB/s)\n", thread_counts[t], elapsed / 1e6,
+                   (double)par_size * sizeof(int) / elapsed);
+        }
+        free(par_arr);
+    }
+
+    // h3 -- Dataset Distribution Sensitivity
+    // h4 -- The fixed-position probes above pin the exit point; here the data
+    // h4 -- and the probe stream both come from the seeded generators, so the
+    // h4 -- reported cost is the average over realistic hit positions
+    printf("\n\n3e. DATASET DISTRIBUTION SENSITIVITY\n");
+    printf("====================================\n");
+    int dist_size = 1000000;
+    const int dist_nprobes = 4096;
+    int *dist_arr = (int *)malloc(dist_size * sizeof(int));
+    int *dist_probes = (int *)malloc(dist_nprobes * sizeof(int));
+    if (dist_arr != NULL && dist_probes != NULL)
+    {
+        printf("Generated datasets, %d elements, %d-probe streams:\n",
+               dist_size, dist_nprobes);
+
+        // Uniform data, probing values known to be present: the exit point is
+        // uniformly distributed, so the median is the honest average case
+        dataset_uniform(dist_arr, dist_size, dist_size, 101);
+        unsigned int pick_seed = 202;
+        for (int i = 0; i < dist_nprobes; i++)
+        {
+            dist_probes[i] = dist_arr[rand_r(&pick_seed) % (unsigned int)dist_size];
+        }
+        DistBenchCtx dctx = {linear_search, dist_arr, dist_size,
+                             dist_probes, dist_nprobes, 0};
+        BenchStats dstats = bench_measure(run_dist_once, &dctx, 10, 200);
+        bench_print("uniform hits, scalar   ", &dstats);
+        dctx.fn = linear_search_simd;
+        dctx.cursor = 0;
+        dstats = bench_measure(run_dist_once, &dctx, 10, 200);
+        bench_print("uniform hits, SIMD     ", &dstats);
+
+        // Duplicate-heavy data: only 100 distinct values, so a present key is
+        // found within the first ~100 elements while a miss scans everything -
+        // a bimodal distribution the sequential fill can never produce
+        dataset_duplicate_heavy(dist_arr, dist_size, 100, 303);
+        dataset_uniform(dist_probes, dist_nprobes, 200, 404); // Half present
+        dctx.fn = linear_search_simd;
+        dctx.cursor = 0;
+        dstats = bench_measure(run_dist_once, &dctx, 10, 200);
+        bench_print("dup-heavy mixed, SIMD  ", &dstats);
+        printf("  (dup-heavy: median is a near-instant hit, p99 a full-array miss)\n");
+    }
+    free(dist_arr);
+    free(dist_probes);
+
     // h3 -- Complexity Verification
     // h4 -- Demonstrate O(n) time complexity
     printf("\n4. COMPLEXITY VERIFICATION\n");
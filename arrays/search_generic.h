@@ -0,0 +1,106 @@
+// h1 -- Type-Generic Search Specializations
+// h2 -- The int-only linear_search()/binary_search() force 64-bit keys and
+// h2 -- struct records through libc bsearch() with a comparator function
+// h2 -- pointer the compiler cannot inline. These macros stamp out fully
+// h2 -- specialized search loops per element type, so the comparison stays
+// h2 -- inlined in the loop with zero per-call indirection
+// h2 -- Usage: include this header and call the ready-made i32/i64/f32/f64
+// h2 -- specializations, or instantiate the macros for your own types
+
+#ifndef SEARCH_GENERIC_H
+#define SEARCH_GENERIC_H
+
+// h3 -- Linear Search Generator
+// h4 -- Expands to a specialized linear search named `name` over `elem_type`
+// h6 -- Returns: Index of first occurrence, -1 if not found
+#define DEFINE_LINEAR_SEARCH(name, elem_type)                                 \
+    static inline int name(const elem_type arr[], int size, elem_type target) \
+    {                                                                         \
+        if (size <= 0)                                                        \
+        {                                                                     \
+            return -1;                                                        \
+        }                                                                     \
+        for (int i = 0; i < size; i++)                                        \
+        {                                                                     \
+            if (arr[i] == target)                                             \
+                return i;                                                     \
+        }                                                                     \
+        return -1;                                                            \
+    }
+
+// h3 -- Binary Search Generator
+// h4 -- Expands to a specialized binary search named `name` over `elem_type`
+// h4 -- Same overflow-safe midpoint logic as binary_search() in binary_s.c
+// h6 -- Returns: Index of target if found, -1 if not found
+#define DEFINE_BINARY_SEARCH(name, elem_type)                                 \
+    static inline int name(const elem_type arr[], int size, elem_type target) \
+    {                                                                         \
+        int low = 0;                                                          \
+        int high = size - 1;                                                  \
+        while (low <= high)                                                   \
+        {                                                                     \
+            int mid = low + (high - low) / 2;                                 \
+            if (arr[mid] == target)                                           \
+                return mid;                                                   \
+            else if (arr[mid] < target)                                       \
+                low = mid + 1;                                                \
+            else                                                              \
+                high = mid - 1;                                               \
+        }                                                                     \
+        return -1;                                                            \
+    }
+
+// h3 -- Keyed Binary Search Generator (struct records)
+// h4 -- `key_of` is a macro or inline function mapping a const elem_type*
+// h4 -- to its key_type key; it expands inline, so searching an array of
+// h4 -- records costs the same as searching a bare key array
+// h6 -- Returns: Index of a record whose key equals target, -1 if not found
+#define DEFINE_BINARY_SEARCH_BY_KEY(name, elem_type, key_type, key_of)       \
+    static inline int name(const elem_type arr[], int size, key_type target) \
+    {                                                                        \
+        int low = 0;                                                         \
+        int high = size - 1;                                                 \
+        while (low <= high)                                                  \
+        {                                                                    \
+            int mid = low + (high - low) / 2;                                \
+            key_type key = key_of(&arr[mid]);                                \
+            if (key == target)                                               \
+                return mid;                                                  \
+            else if (key < target)                                           \
+                low = mid + 1;                                               \
+            else                                                             \
+                high = mid - 1;                                              \
+        }                                                                    \
+        return -1;                                                           \
+    }
+
+// h3 -- Keyed Linear Search Generator (struct records)
+// h6 -- Returns: Index of first record whose key equals target, -1 if not
+#define DEFINE_LINEAR_SEARCH_BY_KEY(name, elem_type, key_type, key_of)       \
+    static inline int name(const elem_type arr[], int size, key_type target) \
+    {                                                                        \
+        if (size <= 0)                                                       \
+        {                                                                    \
+            return -1;                                                       \
+        }                                                                    \
+        for (int i = 0; i < size; i++)                                       \
+        {                                                                    \
+            if (key_of(&arr[i]) == target)                                   \
+                return i;                                                    \
+        }                                                                    \
+        return -1;                                                           \
+    }
+
+// h3 -- Ready-Made Specializations
+// h4 -- The element types production code actually runs
+DEFINE_LINEAR_SEARCH(linear_search_i32, int)
+DEFINE_LINEAR_SEARCH(linear_search_i64, long long)
+DEFINE_LINEAR_SEARCH(linear_search_f32, float)
+DEFINE_LINEAR_SEARCH(linear_search_f64, double)
+
+DEFINE_BINARY_SEARCH(binary_search_i32, int)
+DEFINE_BINARY_SEARCH(binary_search_i64, long long)
+DEFINE_BINARY_SEARCH(binary_search_f32, float)
+DEFINE_BINARY_SEARCH(binary_search_f64, double)
+
+#endif // SEARCH_GENERIC_H
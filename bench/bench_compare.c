@@ -0,0 +1,152 @@
+// h1 -- Benchmark Baseline Comparison Tool
+// h2 -- Loads two CSV logs produced via BENCH_LOG (see bench_timing.h) and
+// h2 -- flags every case whose median or p99 regressed beyond a threshold,
+// h2 -- turning the harnesses' ad-hoc prints into a regression gate:
+// h2 --   BENCH_LOG=baseline.csv ./bs            (on the known-good build)
+// h2 --   BENCH_LOG=current.csv  ./bs            (on the candidate build)
+// h2 --   ./bench_compare baseline.csv current.csv [threshold_pct]
+// h2 -- Exit status is the number of regressions (capped), so it can gate a
+// h2 -- release script directly
+// h2 -- Build: gcc -O2 -Wall -Wextra bench_compare.c -o bench_compare
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_ROWS 4096
+#define MAX_LABEL 128
+
+// h3 -- One Parsed CSV Row
+typedef struct
+{
+    char label[MAX_LABEL];
+    double min_ns, median_ns, p99_ns, max_ns;
+    int samples;
+} ResultRow;
+
+// h3 -- Load a Result Log
+// h4 -- Skips '#' metadata comments and the column header; rows stay in file
+// h4 -- order because repeated labels (e.g. "Last" once per list flavor) are
+// h4 -- matched positionally against the other log
+// h6 -- Returns: Number of rows parsed, or -1 if the file cannot be opened
+static int load_results(const char *path, ResultRow rows[], int max_rows)
+{
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return -1;
+    }
+
+    int n = 0;
+    char line[512];
+    while (n < max_rows && fgets(line, sizeof(line), f) != NULL)
+    {
+        if (line[0] == '#' || strncmp(line, "label,", 6) == 0)
+        {
+            continue;
+        }
+
+        // Label is everything before the first comma (labels never contain one)
+        char *comma = strchr(line, ',');
+        if (comma == NULL)
+        {
+            continue;
+        }
+        *comma = '\0';
+        size_t label_len = strlen(line);
+        if (label_len >= MAX_LABEL)
+        {
+            label_len = MAX_LABEL - 1; // Oversized labels are truncated
+        }
+        memcpy(rows[n].label, line, label_len);
+        rows[n].label[label_len] = '\0';
+        if (sscanf(comma + 1, "%lf,%lf,%lf,%lf,%d", &rows[n].min_ns,
+                   &rows[n].median_ns, &rows[n].p99_ns, &rows[n].max_ns,
+                   &rows[n].samples) == 5)
+        {
+            n++;
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+// h3 -- Percent Change From Baseline
+static double pct_change(double baseline, double current)
+{
+    if (baseline <= 0.0)
+    {
+        return 0.0;
+    }
+    return (current - baseline) / baseline * 100.0;
+}
+
+// h1 --
+int main(int argc, char *argv[])
+{
+    if (argc < 3 || argc > 4)
+    {
+        fprintf(stderr, "Usage: %s <baseline.csv> <current.csv> [threshold_pct]\n",
+                argv[0]);
+        fprintf(stderr, "Flags cases whose median or p99 regressed more than\n");
+        fprintf(stderr, "threshold_pct (default 10) versus the baseline.\n");
+        return 1;
+    }
+    double threshold = (argc == 4) ? atof(argv[3]) : 10.0;
+
+    static ResultRow baseline[MAX_ROWS], current[MAX_ROWS];
+    int nbase = load_results(argv[1], baseline, MAX_ROWS);
+    int ncurr = load_results(argv[2], current, MAX_ROWS);
+    if (nbase < 0 || ncurr < 0)
+    {
+        return 1;
+    }
+
+    printf("Baseline: %s (%d cases)\n", argv[1], nbase);
+    printf("Current:  %s (%d cases)\n", argv[2], ncurr);
+    printf("Threshold: %.1f%% on median or p99\n\n", threshold);
+
+    if (nbase != ncurr)
+    {
+        printf("WARNING: case counts differ - the benchmark layout changed,\n");
+        printf("         comparing the common prefix only\n\n");
+    }
+
+    int n = (nbase < ncurr) ? nbase : ncurr;
+    int regressions = 0, improvements = 0, skipped = 0;
+    for (int i = 0; i < n; i++)
+    {
+        if (strcmp(baseline[i].label, current[i].label) != 0)
+        {
+            printf("SKIP     %-40s baseline has '%s' here\n", current[i].label,
+                   baseline[i].label);
+            skipped++;
+            continue;
+        }
+
+        double median_pct = pct_change(baseline[i].median_ns, current[i].median_ns);
+        double p99_pct = pct_change(baseline[i].p99_ns, current[i].p99_ns);
+
+        if (median_pct > threshold || p99_pct > threshold)
+        {
+            printf("REGRESSED %-40s median %8.0f -> %8.0f ns (%+.1f%%), "
+                   "p99 %8.0f -> %8.0f ns (%+.1f%%)\n",
+                   current[i].label, baseline[i].median_ns, current[i].median_ns,
+                   median_pct, baseline[i].p99_ns, current[i].p99_ns, p99_pct);
+            regressions++;
+        }
+        else if (median_pct < -threshold)
+        {
+            improvements++;
+        }
+    }
+
+    printf("\n%d compared, %d regressed, %d improved, %d skipped\n",
+           n, regressions, improvements, skipped);
+    printf(regressions == 0 ? "PASS\n" : "FAIL\n");
+
+    // Exit status doubles as the gate result; cap below the shell's special
+    // exit codes
+    return (regressions > 100) ? 100 : regressions;
+}
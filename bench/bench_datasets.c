@@ -0,0 +1,114 @@
+// h1 -- Shared Benchmark Dataset Generators (implementation)
+// h2 -- All randomness goes through rand_r() on a caller-supplied seed so
+// h2 -- every distribution is reproducible and two harnesses can generate
+// h2 -- identical datasets independently
+
+#include "bench_datasets.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+// h3 -- Uniform Draw in [0, 1)
+// h4 -- rand_r() gives at most 31 bits; combine two draws so the double has
+// h4 -- enough resolution for the Zipf inverse transform
+static double uniform01(unsigned int *seed)
+{
+    double hi = (double)rand_r(seed);
+    double lo = (double)rand_r(seed);
+    return (hi * ((double)RAND_MAX + 1.0) + lo) /
+           (((double)RAND_MAX + 1.0) * ((double)RAND_MAX + 1.0));
+}
+
+// h3 -- Uniform Random Fill
+void dataset_uniform(int arr[], int n, int max_value, unsigned int seed)
+{
+    if (max_value < 1)
+    {
+        max_value = 1;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        arr[i] = (int)(rand_r(&seed) % (unsigned int)max_value);
+    }
+}
+
+// h3 -- Zipfian-Skewed Fill
+// h4 -- Inverse-transform sampling on the continuous bounded power law: for
+// h4 -- skew s != 1, rank = (u * (N^(1-s) - 1) + 1)^(1/(1-s)); for s == 1
+// h4 -- the CDF is logarithmic and rank = N^u. Both map u in [0,1) onto
+// h4 -- [1, N] with rank 1 most likely, which is the Zipf shape without
+// h4 -- precomputing a harmonic-number table per call
+void dataset_zipfian(int arr[], int n, int distinct, double skew, unsigned int seed)
+{
+    if (distinct < 1)
+    {
+        distinct = 1;
+    }
+    double N = (double)distinct;
+    for (int i = 0; i < n; i++)
+    {
+        double u = uniform01(&seed);
+        double rank;
+        if (skew > 0.999 && skew < 1.001)
+        {
+            rank = pow(N, u);
+        }
+        else
+        {
+            rank = pow(u * (pow(N, 1.0 - skew) - 1.0) + 1.0, 1.0 / (1.0 - skew));
+        }
+        int value = (int)rank - 1; // Ranks are 1-based; values 0-based
+        if (value < 0)
+        {
+            value = 0;
+        }
+        if (value >= distinct)
+        {
+            value = distinct - 1;
+        }
+        arr[i] = value;
+    }
+}
+
+// h3 -- Duplicate-Heavy Fill
+void dataset_duplicate_heavy(int arr[], int n, int distinct, unsigned int seed)
+{
+    if (distinct < 1)
+    {
+        distinct = 1;
+    }
+    for (int i = 0; i < n; i++)
+    {
+        arr[i] = (int)(rand_r(&seed) % (unsigned int)distinct);
+    }
+}
+
+// h3 -- Interpolation-Adversarial Fill (sorted)
+void dataset_interpolation_adversarial(int arr[], int n)
+{
+    // Dense 0 .. n-2, then one outlier far above the rest. Every in-range
+    // target's position estimate (target / outlier) * n rounds to ~0, so
+    // interpolation crawls up from the bottom one narrow step at a time
+    for (int i = 0; i < n - 1; i++)
+    {
+        arr[i] = i;
+    }
+    if (n >= 1)
+    {
+        arr[n - 1] = (n > 1) ? n * 1000 : 0;
+    }
+}
+
+// h3 -- Ascending Comparator
+static int compare_ints_ascending(const void *a, const void *b)
+{
+    int va = *(const int *)a;
+    int vb = *(const int *)b;
+    return (va > vb) - (va < vb);
+}
+
+// h3 -- Sort Ascending Helper
+void dataset_sort_ascending(int arr[], int n)
+{
+    qsort(arr, n, sizeof(int), compare_ints_ascending);
+}
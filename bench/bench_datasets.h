@@ -0,0 +1,59 @@
+// h1 -- Shared Benchmark Dataset Generators (interface)
+// h2 -- Sequential fills (arr[i] = i) are the friendliest possible input: the
+// h2 -- prefetcher streams them and the branch predictor learns them, so the
+// h2 -- numbers flatter every kernel. These generators produce the inputs
+// h2 -- production actually sees - random, skewed, duplicate-heavy, and
+// h2 -- adversarial - all seeded so a run is reproducible bit-for-bit
+// h2 -- Link bench_datasets.c into any program that includes this header; it
+// h2 -- uses pow(), so add -lm, e.g.:
+// h2 --   gcc -O2 -Wall -Wextra binary_s.c ../bench/bench_timing.c ../bench/bench_datasets.c -o bs -lpthread -lm
+
+#ifndef BENCH_DATASETS_H
+#define BENCH_DATASETS_H
+
+// h3 -- Uniform Random Fill
+// h4 -- Independent draws in [0, max_value); duplicates occur at the natural
+// h4 -- birthday rate
+// h5 -- arr[]: Output array
+// h5 -- n: Number of elements to generate
+// h5 -- max_value: Exclusive upper bound on values
+// h5 -- seed: RNG seed (same seed, same data)
+void dataset_uniform(int arr[], int n, int max_value, unsigned int seed);
+
+// h3 -- Zipfian-Skewed Fill
+// h4 -- Power-law popularity: rank 1 dominates, the tail is rarely drawn -
+// h4 -- the shape of real key popularity in caches and query logs
+// h5 -- arr[]: Output array
+// h5 -- n: Number of elements to generate
+// h5 -- distinct: Number of distinct values (ranks 0 .. distinct-1)
+// h5 -- skew: Zipf exponent; ~1.0 is the classic web-workload shape,
+// h5 --       larger means more concentrated
+// h5 -- seed: RNG seed
+void dataset_zipfian(int arr[], int n, int distinct, double skew, unsigned int seed);
+
+// h3 -- Duplicate-Heavy Fill
+// h4 -- Uniform draws over only `distinct` values, so long runs of equal
+// h4 -- keys appear once sorted - exercises equal_range()-style code and
+// h4 -- branch behavior that sequential fills never show
+// h5 -- arr[]: Output array
+// h5 -- n: Number of elements to generate
+// h5 -- distinct: Number of distinct values
+// h5 -- seed: RNG seed
+void dataset_duplicate_heavy(int arr[], int n, int distinct, unsigned int seed);
+
+// h3 -- Interpolation-Adversarial Fill (sorted)
+// h4 -- Deterministic worst case for interpolation_search(): a dense run of
+// h4 -- small values capped by one huge outlier. The outlier stretches the
+// h4 -- value range so the linear estimate lands near index 0 for every
+// h4 -- in-range target and the search degrades toward O(n) steps, while
+// h4 -- binary search is unaffected
+// h5 -- arr[]: Output array, produced already sorted ascending
+// h5 -- n: Number of elements to generate (needs n >= 2 for the outlier)
+void dataset_interpolation_adversarial(int arr[], int n);
+
+// h3 -- Sort Ascending Helper
+// h4 -- The search kernels need sorted input; generators above (except the
+// h4 -- adversarial one) produce unsorted streams
+void dataset_sort_ascending(int arr[], int n);
+
+#endif // BENCH_DATASETS_H
@@ -0,0 +1,342 @@
+// h1 -- Shared Benchmark Timing Harness (implementation)
+// h2 -- Replaces the old per-call clock() timing, whose resolution is far
+// h2 -- coarser than a sub-microsecond search: numbers came out as zero noise
+// h2 -- CLOCK_MONOTONIC gives ~20ns resolution and is immune to wall-clock
+// h2 -- adjustments, which is cycle-accurate enough for every kernel here
+
+#include "bench_timing.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#if !defined(__GNUC__) && !defined(__clang__)
+volatile long bench_sink; // Storage for the fallback compiler barrier
+#endif
+
+// h3 -- Current Monotonic Time
+double bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// h3 -- Sample Comparator
+// h4 -- qsort() comparator for nanosecond samples (ascending)
+static int compare_samples(const void *a, const void *b)
+{
+    double da = *(const double *)a;
+    double db = *(const double *)b;
+    return (da > db) - (da < db);
+}
+
+// h3 -- Statistics From Raw Samples
+BenchStats bench_stats_from_samples(double *samples_ns, int n)
+{
+    BenchStats stats = {0.0, 0.0, 0.0, 0.0, 0.0, 0};
+    if (samples_ns == NULL || n <= 0)
+    {
+        return stats;
+    }
+
+    qsort(samples_ns, n, sizeof(double), compare_samples);
+
+    stats.samples = n;
+    stats.min_ns = samples_ns[0];
+    stats.median_ns = samples_ns[n / 2];
+    stats.p99_ns = samples_ns[(int)(n * 0.99)];
+    stats.max_ns = samples_ns[n - 1];
+    for (int i = 0; i < n; i++)
+    {
+        stats.total_ns += samples_ns[i];
+    }
+    return stats;
+}
+
+// h3 -- Measure a Callback
+BenchStats bench_measure(BenchFn fn, void *ctx, int warmup, int samples)
+{
+    BenchStats empty = {0.0, 0.0, 0.0, 0.0, 0.0, 0};
+    if (fn == NULL || samples <= 0)
+    {
+        return empty;
+    }
+
+    // Untimed warmup: fills caches and trains the branch predictor so the
+    // timed samples measure steady state, not cold-start effects
+    for (int i = 0; i < warmup; i++)
+    {
+        int result = fn(ctx);
+        BENCH_DO_NOT_OPTIMIZE(result);
+    }
+
+    double *samples_ns = (double *)malloc(samples * sizeof(double));
+    if (samples_ns == NULL)
+    {
+        return empty;
+    }
+
+    for (int i = 0; i < samples; i++)
+    {
+        double start = bench_now_ns();
+        int result = fn(ctx);
+        BENCH_DO_NOT_OPTIMIZE(result);
+        samples_ns[i] = bench_now_ns() - start;
+    }
+
+    BenchStats stats = bench_stats_from_samples(samples_ns, samples);
+    free(samples_ns);
+    return stats;
+}
+
+// h2 -- Machine-readable result log: BENCH_LOG=file ./program appends every
+// h2 -- printed case as a CSV row, with a comment header identifying the
+// h2 -- program, git commit, CPU and date - the baseline format consumed by
+// h2 -- the bench_compare regression gate
+static FILE *bench_log_file = NULL;
+static int bench_log_checked = 0;
+
+// h3 -- One Line From a Command or File
+// h4 -- Best effort: writes "unknown" when the source cannot be read
+static void read_first_line(const char *cmd_or_path, int is_command,
+                            char *out, size_t out_size)
+{
+    out[0] = '\0';
+    FILE *f = is_command ? popen(cmd_or_path, "r") : fopen(cmd_or_path, "r");
+    if (f != NULL)
+    {
+        if (fgets(out, (int)out_size, f) != NULL)
+        {
+            out[strcspn(out, "\n")] = '\0';
+        }
+        if (is_command)
+        {
+            pclose(f);
+        }
+        else
+        {
+            fclose(f);
+        }
+    }
+    if (out[0] == '\0')
+    {
+        snprintf(out, out_size, "unknown");
+    }
+}
+
+// h3 -- CPU Model Name
+// h4 -- First "model name" line from /proc/cpuinfo (Linux); "unknown" elsewhere
+static void read_cpu_model(char *out, size_t out_size)
+{
+    out[0] = '\0';
+    FILE *f = fopen("/proc/cpuinfo", "r");
+    if (f != NULL)
+    {
+        char line[256];
+        while (fgets(line, sizeof(line), f) != NULL)
+        {
+            if (strncmp(line, "model name", 10) == 0)
+            {
+                const char *colon = strchr(line, ':');
+                if (colon != NULL)
+                {
+                    snprintf(out, out_size, "%s", colon + 2);
+                    out[strcspn(out, "\n")] = '\0';
+                }
+                break;
+            }
+        }
+        fclose(f);
+    }
+    if (out[0] == '\0')
+    {
+        snprintf(out, out_size, "unknown");
+    }
+}
+
+// h3 -- Log Statistics as CSV
+void bench_log_stats(const char *label, const BenchStats *stats)
+{
+    if (!bench_log_checked)
+    {
+        bench_log_checked = 1;
+        const char *path = getenv("BENCH_LOG");
+        if (path != NULL && path[0] != '\0')
+        {
+            bench_log_file = fopen(path, "a");
+            if (bench_log_file != NULL)
+            {
+                char program[128], commit[128], cpu[256];
+                read_first_line("/proc/self/comm", 0, program, sizeof(program));
+                read_first_line("git rev-parse --short HEAD 2>/dev/null", 1,
+                                commit, sizeof(commit));
+                read_cpu_model(cpu, sizeof(cpu));
+                time_t now = time(NULL);
+                char date[64];
+                strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", localtime(&now));
+                fprintf(bench_log_file, "# program: %s\n", program);
+                fprintf(bench_log_file, "# git_commit: %s\n", commit);
+                fprintf(bench_log_file, "# cpu_model: %s\n", cpu);
+                fprintf(bench_log_file, "# date: %s\n", date);
+                fprintf(bench_log_file, "label,min_ns,median_ns,p99_ns,max_ns,samples\n");
+            }
+        }
+    }
+    if (bench_log_file == NULL)
+    {
+        return;
+    }
+
+    // Trim the alignment padding off the label so keys are stable
+    char trimmed[128];
+    snprintf(trimmed, sizeof(trimmed), "%s", label);
+    int len = (int)strlen(trimmed);
+    while (len > 0 && trimmed[len - 1] == ' ')
+    {
+        trimmed[--len] = '\0';
+    }
+
+    fprintf(bench_log_file, "%s,%.0f,%.0f,%.0f,%.0f,%d\n", trimmed,
+            stats->min_ns, stats->median_ns, stats->p99_ns, stats->max_ns,
+            stats->samples);
+    fflush(bench_log_file); // Survive a crashed or killed run
+}
+
+// h3 -- Print Statistics
+void bench_print(const char *label, const BenchStats *stats)
+{
+    printf("  %s: min %.0f ns, median %.0f ns, p99 %.0f ns (%d samples)\n",
+           label, stats->min_ns, stats->median_ns, stats->p99_ns, stats->samples);
+    bench_log_stats(label, stats);
+}
+
+// h3 -- Print Throughput
+void bench_print_throughput(const char *label, const BenchStats *stats,
+                            double elements_per_op, double bytes_per_op)
+{
+    if (stats->median_ns <= 0.0)
+    {
+        return;
+    }
+    printf("  %s: %.1f M elements/s, %.2f GB/s effective\n", label,
+           elements_per_op / stats->median_ns * 1e3,
+           bytes_per_op / stats->median_ns);
+}
+
+// h2 -- Hardware counters: perf_event_open is Linux-only and may be refused
+// h2 -- by permissions or container seccomp filters; everything degrades to
+// h2 -- available=0 so callers can keep one code path
+#if defined(__linux__)
+
+#include <string.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+// h3 -- Open One Hardware Counter
+// h4 -- Returns the perf fd, or -1 when the event cannot be opened
+static int perf_open(unsigned int type, unsigned long long config)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+// h3 -- Count a Callback
+BenchCounters bench_count(BenchFn fn, void *ctx, int repeats)
+{
+    BenchCounters counters = {0.0, 0.0, 0.0, 0};
+    if (fn == NULL || repeats <= 0)
+    {
+        return counters;
+    }
+
+    unsigned long long l1d_read_miss =
+        PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    unsigned long long llc_read_miss =
+        PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+    int fds[3];
+    fds[0] = perf_open(PERF_TYPE_HW_CACHE, l1d_read_miss);
+    fds[1] = perf_open(PERF_TYPE_HW_CACHE, llc_read_miss);
+    fds[2] = perf_open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES);
+    if (fds[0] < 0 || fds[1] < 0 || fds[2] < 0)
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            if (fds[i] >= 0)
+                close(fds[i]);
+        }
+        return counters; // available stays 0
+    }
+
+    for (int i = 0; i < 3; i++)
+    {
+        ioctl(fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+
+    for (int r = 0; r < repeats; r++)
+    {
+        int result = fn(ctx);
+        BENCH_DO_NOT_OPTIMIZE(result);
+    }
+
+    long long totals[3] = {0, 0, 0};
+    int reads_ok = 1;
+    for (int i = 0; i < 3; i++)
+    {
+        ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        if (read(fds[i], &totals[i], sizeof(totals[i])) != sizeof(totals[i]))
+        {
+            reads_ok = 0;
+        }
+        close(fds[i]);
+    }
+    if (!reads_ok)
+    {
+        return counters;
+    }
+
+    counters.l1d_misses = (double)totals[0] / repeats;
+    counters.llc_misses = (double)totals[1] / repeats;
+    counters.branch_misses = (double)totals[2] / repeats;
+    counters.available = 1;
+    return counters;
+}
+
+#else // !__linux__
+
+BenchCounters bench_count(BenchFn fn, void *ctx, int repeats)
+{
+    (void)fn;
+    (void)ctx;
+    (void)repeats;
+    BenchCounters counters = {0.0, 0.0, 0.0, 0};
+    return counters;
+}
+
+#endif // __linux__
+
+// h3 -- Print Hardware Counters
+void bench_print_counters(const char *label, const BenchCounters *counters)
+{
+    if (!counters->available)
+    {
+        printf("  %s: hardware counters unavailable (perf_event_open refused)\n", label);
+        return;
+    }
+    printf("  %s: %.1f L1d misses, %.1f LLC misses, %.1f branch misses per op\n",
+           label, counters->l1d_misses, counters->llc_misses, counters->branch_misses);
+}
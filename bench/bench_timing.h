@@ -0,0 +1,101 @@
+// h1 -- Shared Benchmark Timing Harness (interface)
+// h2 -- Nanosecond timing via clock_gettime(CLOCK_MONOTONIC) with warmup,
+// h2 -- min/median/p99 statistics, and a compiler barrier so measured results
+// h2 -- cannot be dead-code-eliminated under -O2
+// h2 -- Link bench_timing.c into any program that includes this header, e.g.:
+// h2 --   gcc -O2 -Wall -Wextra linear_search.c ../bench/bench_timing.c -o ls -lpthread
+
+#ifndef BENCH_TIMING_H
+#define BENCH_TIMING_H
+
+// h3 -- Compiler Barrier Macro
+// h4 -- Forces the compiler to treat `value` as used and to order memory
+// h4 -- accesses around it, so a benchmarked call cannot be optimized away
+#if defined(__GNUC__) || defined(__clang__)
+#define BENCH_DO_NOT_OPTIMIZE(value) __asm__ volatile("" : : "g"(value) : "memory")
+#else
+extern volatile long bench_sink; // Fallback: store through a volatile
+#define BENCH_DO_NOT_OPTIMIZE(value) (bench_sink = (long)(value))
+#endif
+
+// h3 -- Benchmark Statistics Structure
+// h4 -- Summary of one measured distribution, all times in nanoseconds
+typedef struct
+{
+    double min_ns;    // Fastest sample (closest to true cost, least noise)
+    double median_ns; // 50th percentile - the headline number
+    double p99_ns;    // 99th percentile - tail latency
+    double max_ns;    // Slowest sample (usually an interrupt or migration)
+    double total_ns;  // Sum of all samples, for throughput math
+    int samples;      // Number of measured samples
+} BenchStats;
+
+// h3 -- Benchmark Callback Type
+// h4 -- One timed operation; return a value derived from the work done so
+// h4 -- the harness can feed it through the compiler barrier
+typedef int (*BenchFn)(void *ctx);
+
+// h3 -- Current Monotonic Time
+// h6 -- Returns: CLOCK_MONOTONIC time in nanoseconds as a double
+double bench_now_ns(void);
+
+// h3 -- Measure a Callback
+// h4 -- Runs `warmup` untimed calls, then `samples` timed calls, each result
+// h4 -- passed through BENCH_DO_NOT_OPTIMIZE
+// h6 -- Returns: Statistics over the timed samples
+BenchStats bench_measure(BenchFn fn, void *ctx, int warmup, int samples);
+
+// h3 -- Statistics From Raw Samples
+// h4 -- For callers that collect their own per-operation timings
+// h5 -- samples_ns: Sample array in nanoseconds - SORTED IN PLACE
+// h5 -- n: Number of samples
+// h6 -- Returns: Statistics over the given samples
+BenchStats bench_stats_from_samples(double *samples_ns, int n);
+
+// h3 -- Print Statistics
+// h4 -- One-line human-readable summary in the repo's benchmark output style
+// h4 -- When the BENCH_LOG environment variable names a file, every printed
+// h4 -- case is also appended there as a CSV row (see bench_log_stats), so a
+// h4 -- run can be kept as a baseline without touching the programs
+void bench_print(const char *label, const BenchStats *stats);
+
+// h3 -- Log Statistics as CSV
+// h4 -- Appends one machine-readable row to the file named by BENCH_LOG:
+// h4 --   label,min_ns,median_ns,p99_ns,max_ns,samples
+// h4 -- The first row a process writes is preceded by comment lines with the
+// h4 -- program name, git commit, CPU model, and date, so a stored baseline
+// h4 -- records where its numbers came from. No-op when BENCH_LOG is unset
+// h4 -- Compare two logs with the bench_compare tool in this directory
+void bench_log_stats(const char *label, const BenchStats *stats);
+
+// h3 -- Print Throughput
+// h4 -- Derives elements/sec and effective GB/s from the median sample, so
+// h4 -- benchmark output says WHY a variant wins (bandwidth- vs latency-bound)
+// h5 -- elements_per_op: Elements one timed operation touches
+// h5 -- bytes_per_op: Bytes one timed operation moves through the cache
+void bench_print_throughput(const char *label, const BenchStats *stats,
+                            double elements_per_op, double bytes_per_op);
+
+// h3 -- Hardware Counter Results
+// h4 -- Per-operation averages from perf_event_open; `available` is 0 when
+// h4 -- the kernel refuses the events (permissions, container seccomp, or a
+// h4 -- non-Linux build) and the numbers must be ignored
+typedef struct
+{
+    double l1d_misses;    // L1 data cache read misses per operation
+    double llc_misses;    // Last-level cache read misses per operation
+    double branch_misses; // Branch mispredictions per operation
+    int available;        // 1 if the counters could actually be opened
+} BenchCounters;
+
+// h3 -- Count a Callback
+// h4 -- Runs `repeats` calls with L1d/LLC/branch-miss counters enabled and
+// h4 -- returns per-call averages; falls back to available=0 where
+// h4 -- perf_event_open cannot be used
+BenchCounters bench_count(BenchFn fn, void *ctx, int repeats);
+
+// h3 -- Print Hardware Counters
+// h4 -- One-line summary, or a note when counters are unavailable
+void bench_print_counters(const char *label, const BenchCounters *counters);
+
+#endif // BENCH_TIMING_H
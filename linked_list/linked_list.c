@@ -1,6 +1,10 @@
+// Build: gcc -O2 -Wall -Wextra linked_list.c ../bench/bench_timing.c ../bench/bench_datasets.c -o ll -lm
+
 #include <stdio.h>
 #include <stdlib.h>
-#include <time.h>
+
+#include "../bench/bench_timing.h"
+#include "../bench/bench_datasets.h"
 
 typedef struct Node
 {
@@ -8,20 +12,70 @@ typedef struct Node
     struct Node *next, *prev;
 } Node;
 
-Node *createNode(int data)
+/* Arena allocator: nodes are carved from large contiguous slabs instead of
+ * one malloc per node, so creation is a pointer bump and sequentially
+ * created nodes sit physically adjacent for cache-friendly traversal. */
+#define ARENA_SLAB_NODES 65536
+
+typedef struct Slab
+{
+    struct Slab *next;
+    Node nodes[ARENA_SLAB_NODES];
+} Slab;
+
+typedef struct
+{
+    Slab *slabs; /* chain of blocks, newest first */
+    int used;    /* nodes handed out from the newest slab */
+} NodeArena;
+
+NodeArena *arenaCreate(void)
+{
+    NodeArena *a = malloc(sizeof(NodeArena));
+    a->slabs = NULL;
+    a->used = ARENA_SLAB_NODES; /* force a slab on first alloc */
+    return a;
+}
+
+Node *arenaAlloc(NodeArena *a)
 {
-    Node *n = malloc(sizeof(Node));
+    if (a->used == ARENA_SLAB_NODES)
+    {
+        Slab *s = malloc(sizeof(Slab));
+        s->next = a->slabs;
+        a->slabs = s;
+        a->used = 0;
+    }
+    return &a->slabs->nodes[a->used++];
+}
+
+void arenaDestroy(NodeArena *a)
+{
+    Slab *s = a->slabs;
+    while (s)
+    {
+        Slab *next = s->next;
+        free(s);
+        s = next;
+    }
+    free(a);
+}
+
+/* arena == NULL falls back to one malloc per node (the old behavior) */
+Node *createNode(NodeArena *arena, int data)
+{
+    Node *n = arena ? arenaAlloc(arena) : malloc(sizeof(Node));
     n->data = data;
     n->next = n->prev = NULL;
     return n;
 }
 
-Node *createList(int n, int doubly, int circular)
+Node *createList(int n, int doubly, int circular, NodeArena *arena)
 {
     Node *head = NULL, *tail = NULL;
     for (int i = 0; i < n; i++)
     {
-        Node *node = createNode(i);
+        Node *node = createNode(arena, i);
         if (!head)
             head = tail = node;
         else
@@ -41,6 +95,167 @@ Node *createList(int n, int doubly, int circular)
     return head;
 }
 
+/* List handle: head, tail, and length travel together so append is O(1)
+ * for all four flavors instead of an O(n) head walk per insert (building a
+ * 1M queue that way is O(n^2)). Mutators keep the circular and prev links
+ * intact. Arena-backed nodes are unlinked but not individually freed;
+ * their memory returns when the arena is destroyed. */
+typedef struct
+{
+    Node *head, *tail;
+    int length;
+    int doubly, circular;
+    NodeArena *arena; /* NULL means per-node malloc/free */
+} List;
+
+List *listCreate(int doubly, int circular, NodeArena *arena)
+{
+    List *l = malloc(sizeof(List));
+    l->head = l->tail = NULL;
+    l->length = 0;
+    l->doubly = doubly;
+    l->circular = circular;
+    l->arena = arena;
+    return l;
+}
+
+void listAppend(List *l, int data)
+{
+    Node *n = createNode(l->arena, data);
+    if (!l->head)
+    {
+        l->head = l->tail = n;
+        if (l->circular)
+        {
+            n->next = n; /* single-node circle is a self-loop */
+            if (l->doubly)
+                n->prev = n;
+        }
+    }
+    else
+    {
+        l->tail->next = n;
+        if (l->doubly)
+            n->prev = l->tail;
+        l->tail = n;
+        if (l->circular)
+        {
+            n->next = l->head;
+            if (l->doubly)
+                l->head->prev = n;
+        }
+    }
+    l->length++;
+}
+
+/* pos == NULL inserts before the current head; otherwise after pos, which
+ * must be a node of this list. */
+void listInsertAfter(List *l, Node *pos, int data)
+{
+    if (!l->head || !pos)
+    {
+        if (!l->head)
+        {
+            listAppend(l, data);
+            return;
+        }
+        Node *n = createNode(l->arena, data);
+        n->next = l->head;
+        if (l->doubly)
+            l->head->prev = n;
+        l->head = n;
+        if (l->circular)
+        {
+            l->tail->next = n;
+            if (l->doubly)
+                n->prev = l->tail;
+        }
+        l->length++;
+        return;
+    }
+
+    Node *n = createNode(l->arena, data);
+    n->next = pos->next;
+    pos->next = n;
+    if (l->doubly)
+    {
+        n->prev = pos;
+        if (n->next)
+            n->next->prev = n;
+    }
+    if (pos == l->tail)
+        l->tail = n; /* circular: n->next is already head */
+    l->length++;
+}
+
+/* Unlinks node from the list. O(1) for doubly lists and for the head of
+ * any flavor; singly lists pay an O(n) predecessor walk for middle nodes. */
+void listDeleteNode(List *l, Node *node)
+{
+    if (!l->head || !node)
+        return;
+
+    if (l->length == 1)
+    {
+        l->head = l->tail = NULL;
+    }
+    else
+    {
+        Node *prev;
+        if (node == l->head)
+            prev = l->circular ? l->tail : NULL;
+        else if (l->doubly)
+            prev = node->prev;
+        else
+        {
+            prev = l->head;
+            while (prev->next != node)
+                prev = prev->next;
+        }
+
+        if (node == l->head)
+            l->head = node->next;
+        if (prev)
+            prev->next = node->next;
+        if (l->doubly && node->next)
+            node->next->prev = prev;
+        if (node == l->tail)
+            l->tail = prev;
+    }
+
+    if (!l->arena)
+        free(node);
+    l->length--;
+}
+
+void destroyList(Node *head, NodeArena *arena); /* defined below */
+
+void listDestroy(List *l)
+{
+    destroyList(l->head, l->arena);
+    free(l);
+}
+
+/* Teardown. Arena-backed lists release in O(slabs) block frees instead of
+ * O(n) pointer-chasing frees; malloc-backed lists walk node by node, with
+ * the circular case terminating when the walk returns to head instead of
+ * looping forever on the cycle. */
+void destroyList(Node *head, NodeArena *arena)
+{
+    if (arena)
+    {
+        arenaDestroy(arena); /* nodes live in the slabs; no walk needed */
+        return;
+    }
+    Node *curr = head;
+    while (curr)
+    {
+        Node *next = curr->next;
+        free(curr);
+        curr = (next == head) ? NULL : next; /* next == head closes a circle */
+    }
+}
+
 int search(Node *head, int target, int circular, int n)
 {
     Node *curr = head;
@@ -55,30 +270,664 @@ int search(Node *head, int target, int circular, int n)
     return 0;
 }
 
-double benchmark(Node *head, int target, int circular, int n)
+/* Unrolled list: many payload ints per node so a traversal fetches mostly
+ * data instead of pointers. Two pointers + count + 11 ints = one 64-byte
+ * cache line per node, versus 20% payload in the plain Node. */
+#define UNODE_CAP 11
+
+typedef struct UNode
 {
-    clock_t start = clock();
-    search(head, target, circular, n);
-    clock_t end = clock();
-    return (double)(end - start) / CLOCKS_PER_SEC;
+    struct UNode *next, *prev;
+    int count; /* payload slots used in this node */
+    int data[UNODE_CAP];
+} UNode;
+
+UNode *createUnrolledList(int n, int doubly, int circular)
+{
+    UNode *head = NULL, *tail = NULL;
+    int i = 0;
+    while (i < n)
+    {
+        UNode *node = malloc(sizeof(UNode));
+        node->next = node->prev = NULL;
+        node->count = 0;
+        while (node->count < UNODE_CAP && i < n)
+            node->data[node->count++] = i++;
+        if (!head)
+            head = tail = node;
+        else
+        {
+            tail->next = node;
+            if (doubly)
+                node->prev = tail;
+            tail = node;
+        }
+    }
+    if (circular && head && tail)
+    {
+        tail->next = head;
+        if (doubly)
+            head->prev = tail;
+    }
+    return head;
+}
+
+int searchUnrolled(UNode *head, int target, int circular, int n)
+{
+    UNode *curr = head;
+    int seen = 0;
+    if (!curr)
+        return 0;
+    do
+    {
+        for (int k = 0; k < curr->count; k++)
+            if (curr->data[k] == target)
+                return 1;
+        seen += curr->count;
+        curr = curr->next;
+    } while (curr && (!circular || seen < n));
+    return 0;
+}
+
+/* Compact representation: next/prev are 32-bit indices into one contiguous
+ * arena array instead of 8-byte pointers, shrinking the doubly-linked node
+ * from 24 to 12 bytes - half the memory and twice the nodes per cache line.
+ * CNODE_NIL plays the role of NULL. Measured trade-off: traversal is bound
+ * by the serial next-load chain, and scaling an index by 12 adds address
+ * arithmetic to every hop, so against an arena-backed pointer list (already
+ * contiguous and prefetch-friendly) the compact walk is somewhat slower per
+ * hop here - the win is footprint, not latency. */
+#define CNODE_NIL 0xFFFFFFFFu
+
+typedef struct
+{
+    int data;
+    unsigned int next, prev; /* indices into the arena, CNODE_NIL = none */
+} CNode;
+
+typedef struct
+{
+    CNode *nodes;
+    unsigned int count;
+} CompactArena;
+
+/* Same shape as createList(): values 0..n-1, optional prev links, optional
+ * circular closure. Returns the arena; the head is always index 0. */
+CompactArena *createCompactList(int n, int doubly, int circular)
+{
+    CompactArena *a = malloc(sizeof(CompactArena));
+    a->nodes = malloc((size_t)n * sizeof(CNode));
+    a->count = (unsigned int)n;
+    for (int i = 0; i < n; i++)
+    {
+        a->nodes[i].data = i;
+        a->nodes[i].next = (i + 1 < n) ? (unsigned int)(i + 1)
+                                       : (circular ? 0 : CNODE_NIL);
+        a->nodes[i].prev = doubly ? ((i > 0) ? (unsigned int)(i - 1)
+                                             : (circular ? (unsigned int)(n - 1) : CNODE_NIL))
+                                  : CNODE_NIL;
+    }
+    return a;
+}
+
+int searchCompact(CompactArena *a, int target, int circular, int n)
+{
+    unsigned int curr = 0; /* head */
+    int count = 0;
+    if (a->count == 0)
+        return 0;
+    do
+    {
+        if (a->nodes[curr].data == target)
+            return 1;
+        curr = a->nodes[curr].next;
+        count++;
+    } while (curr != CNODE_NIL && (!circular || count < n));
+    return 0;
+}
+
+void destroyCompactList(CompactArena *a)
+{
+    free(a->nodes);
+    free(a);
+}
+
+/* Array-backed ring buffer: the queue the circular lists approximate, without
+ * a node per element. head/count index into one fixed array, so push and pop
+ * are an index increment and search is a linear scan over contiguous ints. */
+typedef struct
+{
+    int *data;
+    int cap, head, count; /* head = oldest element, wraps modulo cap */
+} RingBuffer;
+
+RingBuffer *ringCreate(int cap)
+{
+    RingBuffer *rb = malloc(sizeof(RingBuffer));
+    rb->data = malloc((size_t)cap * sizeof(int));
+    rb->cap = cap;
+    rb->head = 0;
+    rb->count = 0;
+    return rb;
+}
+
+/* Returns 1 on success, 0 when the buffer is full */
+int ringPush(RingBuffer *rb, int value)
+{
+    if (rb->count == rb->cap)
+        return 0;
+    rb->data[(rb->head + rb->count) % rb->cap] = value;
+    rb->count++;
+    return 1;
+}
+
+/* Pops the oldest element into *out. Returns 1 on success, 0 when empty */
+int ringPop(RingBuffer *rb, int *out)
+{
+    if (rb->count == 0)
+        return 0;
+    *out = rb->data[rb->head];
+    rb->head = (rb->head + 1) % rb->cap;
+    rb->count--;
+    return 1;
+}
+
+/* Oldest-to-newest scan, same semantics as search() on a circular list.
+ * Walks the two contiguous segments instead of taking a modulo per element,
+ * so the inner loops are plain array scans the compiler can vectorize. */
+int ringSearch(RingBuffer *rb, int target)
+{
+    int first = rb->cap - rb->head; /* elements before the wrap point */
+    if (first > rb->count)
+        first = rb->count;
+    for (int i = rb->head; i < rb->head + first; i++)
+    {
+        if (rb->data[i] == target)
+            return 1;
+    }
+    for (int i = 0; i < rb->count - first; i++)
+    {
+        if (rb->data[i] == target)
+            return 1;
+    }
+    return 0;
+}
+
+void ringDestroy(RingBuffer *rb)
+{
+    free(rb->data);
+    free(rb);
+}
+
+/* Prefetch-ahead traversal: a scout pointer runs PREFETCH_DIST nodes ahead
+ * of the probe and issues a software prefetch for each node it passes, so
+ * by the time the probe reaches a node its cache miss is already in flight.
+ * Biggest win on arena-backed lists where consecutive nodes are adjacent. */
+#define PREFETCH_DIST 8
+
+int searchPrefetch(Node *head, int target, int circular, int n)
+{
+    Node *curr = head;
+    Node *scout = head;
+    int count = 0;
+    for (int i = 0; i < PREFETCH_DIST && scout; i++)
+        scout = scout->next;
+    do
+    {
+        if (scout)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(scout);
+#endif
+            scout = scout->next;
+        }
+        if (curr->data == target)
+            return 1;
+        curr = curr->next;
+        count++;
+    } while (curr && (!circular || count < n));
+    return 0;
+}
+
+/* Skip list index over an existing Node chain. The chain keeps its cheap
+ * insertion; the index adds probabilistic towers (each node is promoted a
+ * level with probability 1/2) so search is O(log n) expected instead of a
+ * full O(n) pointer chase. Keys must be ascending along the chain, which
+ * is how createList() builds them. */
+#define SKIP_MAX_LEVEL 20
+
+typedef struct SkipNode
+{
+    int key;
+    Node *node;                  /* underlying chain node for this key */
+    struct SkipNode *forward[1]; /* forward[level], allocated per tower */
+} SkipNode;
+
+typedef struct
+{
+    SkipNode *head; /* sentinel tower with SKIP_MAX_LEVEL forwards */
+    int level;      /* tallest tower currently in the index */
+    unsigned int seed;
+} SkipList;
+
+static SkipNode *skipNodeAlloc(int levels)
+{
+    SkipNode *sn = malloc(sizeof(SkipNode) + (levels - 1) * sizeof(SkipNode *));
+    for (int i = 0; i < levels; i++)
+        sn->forward[i] = NULL;
+    return sn;
+}
+
+static int skipRandomLevel(unsigned int *seed)
+{
+    int level = 1;
+    while (level < SKIP_MAX_LEVEL && (rand_r(seed) & 1))
+        level++;
+    return level;
+}
+
+/* Keys arrive ascending, so building is one pass appending at the tail of
+ * every level - O(n) total, no per-insert search needed. */
+SkipList *skipBuild(Node *head, int circular, int n)
+{
+    SkipList *sl = malloc(sizeof(SkipList));
+    sl->head = skipNodeAlloc(SKIP_MAX_LEVEL);
+    sl->level = 1;
+    sl->seed = 12345; /* fixed: reproducible towers */
+
+    SkipNode *tails[SKIP_MAX_LEVEL];
+    for (int i = 0; i < SKIP_MAX_LEVEL; i++)
+        tails[i] = sl->head;
+
+    Node *curr = head;
+    int count = 0;
+    while (curr && (!circular || count < n))
+    {
+        int levels = skipRandomLevel(&sl->seed);
+        SkipNode *sn = skipNodeAlloc(levels);
+        sn->key = curr->data;
+        sn->node = curr;
+        for (int i = 0; i < levels; i++)
+        {
+            tails[i]->forward[i] = sn;
+            tails[i] = sn;
+        }
+        if (levels > sl->level)
+            sl->level = levels;
+        curr = curr->next;
+        count++;
+    }
+    return sl;
+}
+
+int skipSearch(SkipList *sl, int target)
+{
+    SkipNode *x = sl->head;
+    for (int i = sl->level - 1; i >= 0; i--)
+        while (x->forward[i] && x->forward[i]->key < target)
+            x = x->forward[i];
+    x = x->forward[0];
+    return x && x->key == target;
+}
+
+void skipDestroy(SkipList *sl)
+{
+    SkipNode *curr = sl->head;
+    while (curr)
+    {
+        SkipNode *next = curr->forward[0];
+        free(curr);
+        curr = next;
+    }
+    free(sl);
+}
+
+void destroyUnrolledList(UNode *head)
+{
+    UNode *curr = head;
+    while (curr)
+    {
+        UNode *next = curr->next;
+        free(curr);
+        curr = (next == head) ? NULL : next; /* next == head closes a circle */
+    }
+}
+
+typedef struct
+{
+    Node *head;
+    int target, circular, n;
+} BenchCtx;
+
+static int searchOnce(void *ctx)
+{
+    BenchCtx *c = ctx;
+    return search(c->head, c->target, c->circular, c->n);
+}
+
+static int searchPrefetchOnce(void *ctx)
+{
+    BenchCtx *c = ctx;
+    return searchPrefetch(c->head, c->target, c->circular, c->n);
+}
+
+BenchStats benchmarkPrefetch(Node *head, int target, int circular, int n)
+{
+    BenchCtx ctx = {head, target, circular, n};
+    return bench_measure(searchPrefetchOnce, &ctx, 2, 15);
+}
+
+BenchStats benchmark(Node *head, int target, int circular, int n)
+{
+    BenchCtx ctx = {head, target, circular, n};
+    return bench_measure(searchOnce, &ctx, 2, 15);
+}
+
+typedef struct
+{
+    UNode *head;
+    int target, circular, n;
+} UBenchCtx;
+
+static int searchUnrolledOnce(void *ctx)
+{
+    UBenchCtx *c = ctx;
+    return searchUnrolled(c->head, c->target, c->circular, c->n);
+}
+
+BenchStats benchmarkUnrolled(UNode *head, int target, int circular, int n)
+{
+    UBenchCtx ctx = {head, target, circular, n};
+    return bench_measure(searchUnrolledOnce, &ctx, 2, 15);
+}
+
+typedef struct
+{
+    CompactArena *arena;
+    int target, circular, n;
+} CBenchCtx;
+
+static int searchCompactOnce(void *ctx)
+{
+    CBenchCtx *c = ctx;
+    return searchCompact(c->arena, c->target, c->circular, c->n);
+}
+
+BenchStats benchmarkCompact(CompactArena *a, int target, int circular, int n)
+{
+    CBenchCtx ctx = {a, target, circular, n};
+    return bench_measure(searchCompactOnce, &ctx, 2, 15);
+}
+
+typedef struct
+{
+    RingBuffer *rb;
+    int target;
+} RBenchCtx;
+
+static int searchRingOnce(void *ctx)
+{
+    RBenchCtx *c = ctx;
+    return ringSearch(c->rb, c->target);
+}
+
+BenchStats benchmarkRing(RingBuffer *rb, int target)
+{
+    RBenchCtx ctx = {rb, target};
+    return bench_measure(searchRingOnce, &ctx, 2, 15);
+}
+
+typedef struct
+{
+    SkipList *sl;
+    int target;
+} SkipBenchCtx;
+
+static int skipSearchOnce(void *ctx)
+{
+    SkipBenchCtx *c = ctx;
+    return skipSearch(c->sl, c->target);
+}
+
+BenchStats benchmarkSkip(SkipList *sl, int target)
+{
+    SkipBenchCtx ctx = {sl, target};
+    return bench_measure(skipSearchOnce, &ctx, 2, 15);
 }
 
 int main()
 {
     int N = 1000000;
+
+    /* Construction cost: per-node malloc vs arena on the same list shape */
+    double start = bench_now_ns();
+    Node *malloc_list = createList(N, 1, 0, NULL);
+    double malloc_ns = bench_now_ns() - start;
+    BENCH_DO_NOT_OPTIMIZE(malloc_list);
+
+    NodeArena *build_arena = arenaCreate();
+    start = bench_now_ns();
+    Node *arena_list = createList(N, 1, 0, build_arena);
+    double arena_ns = bench_now_ns() - start;
+    BENCH_DO_NOT_OPTIMIZE(arena_list);
+
+    printf("Construction of %d doubly-linked nodes:\n", N);
+    printf("  per-node malloc: %.0f ns (%.1f ns/node)\n", malloc_ns, malloc_ns / N);
+    printf("  arena allocator: %.0f ns (%.1f ns/node)\n", arena_ns, arena_ns / N);
+
+    /* Teardown cost: O(n) pointer-chasing frees vs O(slabs) block frees */
+    start = bench_now_ns();
+    destroyList(malloc_list, NULL);
+    double free_ns = bench_now_ns() - start;
+    malloc_list = NULL;
+
+    start = bench_now_ns();
+    destroyList(arena_list, build_arena);
+    double slab_ns = bench_now_ns() - start;
+    arena_list = NULL;
+
+    printf("Teardown of %d doubly-linked nodes:\n", N);
+    printf("  per-node free:   %.0f ns (%.1f ns/node)\n", free_ns, free_ns / N);
+    printf("  arena teardown:  %.0f ns (%.3f ns/node)\n", slab_ns, slab_ns / N);
+
+    /* Benchmark lists are arena-backed so traversal walks adjacent memory */
+    NodeArena *arenas[4];
     Node *lists[4];
-    lists[0] = createList(N, 0, 0);
-    lists[1] = createList(N, 1, 0);
-    lists[2] = createList(N, 0, 1);
-    lists[3] = createList(N, 1, 1);
+    for (int i = 0; i < 4; i++)
+    {
+        arenas[i] = arenaCreate();
+    }
+    lists[0] = createList(N, 0, 0, arenas[0]);
+    lists[1] = createList(N, 1, 0, arenas[1]);
+    lists[2] = createList(N, 0, 1, arenas[2]);
+    lists[3] = createList(N, 1, 1, arenas[3]);
     const char *names[] = {
         "Singly", "Doubly", "Circular Singly", "Circular Doubly"};
 
     for (int i = 0; i < 4; i++)
     {
         printf("\n%s Linked List:\n", names[i]);
-        printf("First: %f sec\n", benchmark(lists[i], 0, i >= 2, N));
-        printf("Middle: %f sec\n", benchmark(lists[i], N / 2, i >= 2, N));
-        printf("Last: %f sec\n", benchmark(lists[i], N - 1, i >= 2, N));
+        BenchStats first = benchmark(lists[i], 0, i >= 2, N);
+        BenchStats middle = benchmark(lists[i], N / 2, i >= 2, N);
+        BenchStats last = benchmark(lists[i], N - 1, i >= 2, N);
+        bench_print("First ", &first);
+        bench_print("Middle", &middle);
+        bench_print("Last  ", &last);
+        bench_print_throughput("Last  ", &last, N, (double)N * sizeof(Node));
+        BenchCtx counter_ctx = {lists[i], N - 1, i >= 2, N};
+        BenchCounters counters = bench_count(searchOnce, &counter_ctx, 5);
+        bench_print_counters("Last  ", &counters);
+
+        /* Same traversal with the scout prefetching PREFETCH_DIST ahead */
+        if (searchPrefetch(lists[i], N / 2, i >= 2, N) != 1 ||
+            searchPrefetch(lists[i], N, i >= 2, N) != 0)
+            printf("  Prefetch search MISMATCH vs plain traversal!\n");
+        BenchStats pfirst = benchmarkPrefetch(lists[i], 0, i >= 2, N);
+        BenchStats pmiddle = benchmarkPrefetch(lists[i], N / 2, i >= 2, N);
+        BenchStats plast = benchmarkPrefetch(lists[i], N - 1, i >= 2, N);
+        bench_print("Pfch First ", &pfirst);
+        bench_print("Pfch Middle", &pmiddle);
+        bench_print("Pfch Last  ", &plast);
+
+        /* Compact 12-byte nodes: 32-bit offsets instead of pointers */
+        CompactArena *ca = createCompactList(N, i == 1 || i == 3, i >= 2);
+        if (searchCompact(ca, N / 2, i >= 2, N) != 1 ||
+            searchCompact(ca, N, i >= 2, N) != 0)
+            printf("  Compact search MISMATCH vs plain traversal!\n");
+        BenchStats cfirst = benchmarkCompact(ca, 0, i >= 2, N);
+        BenchStats cmiddle = benchmarkCompact(ca, N / 2, i >= 2, N);
+        BenchStats clast = benchmarkCompact(ca, N - 1, i >= 2, N);
+        bench_print("Cmpt First ", &cfirst);
+        bench_print("Cmpt Middle", &cmiddle);
+        bench_print("Cmpt Last  ", &clast);
+        destroyCompactList(ca);
+
+        /* Skip index over the same chain: O(log n) expected per lookup */
+        SkipList *sl = skipBuild(lists[i], i >= 2, N);
+        if (skipSearch(sl, 0) != 1 || skipSearch(sl, N / 2) != 1 ||
+            skipSearch(sl, N - 1) != 1 || skipSearch(sl, N) != 0)
+            printf("  Skip search MISMATCH vs plain traversal!\n");
+        BenchStats sfirst = benchmarkSkip(sl, 0);
+        BenchStats smiddle = benchmarkSkip(sl, N / 2);
+        BenchStats slast = benchmarkSkip(sl, N - 1);
+        bench_print("Skip First ", &sfirst);
+        bench_print("Skip Middle", &smiddle);
+        bench_print("Skip Last  ", &slast);
+        skipDestroy(sl);
+    }
+
+    /* Fifth row: the array-backed ring buffer holding the same N values,
+     * wrapped mid-array so the search crosses the wrap point like a live
+     * queue would. This is what the circular flavors above approximate. */
+    printf("\nRing Buffer (array-backed, %d ints):\n", N);
+    RingBuffer *rb = ringCreate(N);
+    for (int k = 0; k < N / 3; k++) /* push/pop to move head off index 0 */
+        ringPush(rb, -1);
+    int popped;
+    while (ringPop(rb, &popped))
+        ;
+    for (int k = 0; k < N; k++)
+        ringPush(rb, k);
+    if (ringSearch(rb, N / 2) != 1 || ringSearch(rb, N) != 0)
+        printf("  Ring search MISMATCH vs circular list traversal!\n");
+    BenchStats rfirst = benchmarkRing(rb, 0);
+    BenchStats rmiddle = benchmarkRing(rb, N / 2);
+    BenchStats rlast = benchmarkRing(rb, N - 1);
+    bench_print("First ", &rfirst);
+    bench_print("Middle", &rmiddle);
+    bench_print("Last  ", &rlast);
+    bench_print_throughput("Last  ", &rlast, N, (double)N * sizeof(int));
+    ringDestroy(rb);
+
+    /* Same four flavors, unrolled: one cache line of payload per node */
+    UNode *ulists[4];
+    ulists[0] = createUnrolledList(N, 0, 0);
+    ulists[1] = createUnrolledList(N, 1, 0);
+    ulists[2] = createUnrolledList(N, 0, 1);
+    ulists[3] = createUnrolledList(N, 1, 1);
+
+    for (int i = 0; i < 4; i++)
+    {
+        printf("\n%s Unrolled Linked List (%d ints/node):\n", names[i], UNODE_CAP);
+        BenchStats first = benchmarkUnrolled(ulists[i], 0, i >= 2, N);
+        BenchStats middle = benchmarkUnrolled(ulists[i], N / 2, i >= 2, N);
+        BenchStats last = benchmarkUnrolled(ulists[i], N - 1, i >= 2, N);
+        bench_print("First ", &first);
+        bench_print("Middle", &middle);
+        bench_print("Last  ", &last);
+    }
+
+    /* All four circular/non-circular flavors tear down cleanly */
+    for (int i = 0; i < 4; i++)
+    {
+        destroyList(lists[i], arenas[i]);
+        destroyUnrolledList(ulists[i]);
+    }
+
+    /* Mutation throughput via the list handle: O(1) appends, then a
+     * head-delete + tail-insert churn, for all four flavors */
+    printf("\nMutation throughput (list handle, %d appends + %d churn ops):\n",
+           N, 100000);
+    for (int i = 0; i < 4; i++)
+    {
+        NodeArena *ma = arenaCreate();
+        List *l = listCreate(i == 1 || i == 3, i >= 2, ma);
+
+        double s = bench_now_ns();
+        for (int k = 0; k < N; k++)
+            listAppend(l, k);
+        double append_ns = bench_now_ns() - s;
+
+        int churn = 100000;
+        s = bench_now_ns();
+        for (int k = 0; k < churn; k++)
+        {
+            listDeleteNode(l, l->head);
+            listInsertAfter(l, l->tail, N + k);
+        }
+        double churn_ns = bench_now_ns() - s;
+
+        /* Links must survive the churn intact */
+        int ok = l->length == N;
+        if (l->circular)
+            ok = ok && l->tail->next == l->head;
+        else
+            ok = ok && l->tail->next == NULL;
+        if (l->doubly && l->circular)
+            ok = ok && l->head->prev == l->tail;
+        if (l->doubly)
+            ok = ok && l->tail->prev && l->tail->prev->next == l->tail;
+
+        printf("  %s: append %.1f M ops/s, churn %.1f M ops/s (%s)\n",
+               names[i], (double)N / append_ns * 1e3,
+               2.0 * churn / churn_ns * 1e3, ok ? "links OK" : "LINKS BROKEN");
+        listDestroy(l);
+    }
+
+    /* The ring buffer on the same workload: the message-passing comparison.
+     * Push N values, then the same head-pop + tail-push churn. */
+    {
+        RingBuffer *qrb = ringCreate(N);
+        double s = bench_now_ns();
+        for (int k = 0; k < N; k++)
+            ringPush(qrb, k);
+        double append_ns = bench_now_ns() - s;
+
+        int churn = 100000, out = 0;
+        s = bench_now_ns();
+        for (int k = 0; k < churn; k++)
+        {
+            ringPop(qrb, &out);
+            ringPush(qrb, N + k);
+        }
+        double churn_ns = bench_now_ns() - s;
+        BENCH_DO_NOT_OPTIMIZE(out);
+
+        int ok = qrb->count == N && out == churn - 1;
+        printf("  %s: append %.1f M ops/s, churn %.1f M ops/s (%s)\n",
+               "Ring Buffer", (double)N / append_ns * 1e3,
+               2.0 * churn / churn_ns * 1e3, ok ? "queue OK" : "QUEUE BROKEN");
+        ringDestroy(qrb);
+    }
+
+    /* Generated data instead of the sequential 0..N-1 fill: duplicate-heavy
+     * values put a present key within the first few nodes while a miss still
+     * walks the whole chain - the bimodal search cost production data shows,
+     * which the sequential fill above can never produce. */
+    {
+        int *vals = malloc((size_t)N * sizeof(int));
+        dataset_duplicate_heavy(vals, N, 100, 42);
+        NodeArena *da = arenaCreate();
+        List *dl = listCreate(0, 0, da);
+        for (int k = 0; k < N; k++)
+            listAppend(dl, vals[k]);
+
+        printf("\nDuplicate-heavy data (%d nodes, 100 distinct values):\n", N);
+        BenchStats hit = benchmark(dl->head, vals[0], 0, N);
+        BenchStats miss = benchmark(dl->head, 100, 0, N); /* values are 0..99 */
+        bench_print("Hit  ", &hit);
+        bench_print("Miss ", &miss);
+        listDestroy(dl);
+        free(vals);
     }
 }